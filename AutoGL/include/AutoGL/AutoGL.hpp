@@ -1,5 +1,6 @@
 // include/AutoGL/AutoGL.hpp
 #pragma once
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,72 @@ namespace AutoGL {
         Vulkan
     };
 
+    // GL 에러 검사 방식
+    enum class GLDebugMode {
+        Off,    // release: no-error 컨텍스트, 검사 없음
+        Async,  // GL_DEBUG_OUTPUT 콜백
+        Sync    // 동기 콜백, 에러를 낸 GL 호출 위치를 바로 추적할 때 사용
+    };
+
+    // scanShaderFolder 썸네일 아틀라스 모드 옵션
+    struct ThumbnailAtlasOptions {
+        std::string outputPath = "thumbnails";  // <outputPath>.png + <outputPath>.json
+        int   tileSize = 128;                   // 셰이더 하나당 픽셀 크기
+        float time     = 1.0f;                  // 모든 셰이더에 같은 iTime
+        int   workers  = 0;                     // 컴파일 컨텍스트 수 (0 = CPU 수 기준)
+    };
+
+    // 배치 성능 측정 옵션
+    struct BatchOptions {
+        int frames = 120;               // 셰이더마다 그릴 프레임 (compute는 dispatch) 수
+        std::string reportPath;         // .csv면 CSV, 그 외 JSON. 비어 있으면 stdout에 JSON
+        bool useProgramCache = false;   // 끄면 캐시 히트 없이 매번 실제 컴파일 시간을 잼
+    };
+
+    // A/B 비교 측정 옵션
+    struct ABTestOptions {
+        int batches        = 20;    // 셰이더마다 번갈아 측정할 배치 수 (5 미만이면 판정하지 않음)
+        int framesPerBatch = 10;    // 배치 하나에서 그릴 프레임 (compute는 dispatch) 수
+        int warmupFrames   = 10;    // 측정 전에 셰이더마다 그릴 프레임 수 (컴파일/첫 draw 비용 제외)
+        float time         = 1.0f;  // 모든 프레임에 같은 iTime
+        double confidence  = 0.95;  // 속도 비율 신뢰구간 수준
+    };
+
+    // 마우스 입력 발생부터 그 입력을 반영한 프레임을 GPU가 끝낼 때까지의 시간 (최근 샘플 기준)
+    struct InputLatencyStats {
+        std::size_t samples = 0;
+        double meanMs   = 0.0;
+        double medianMs = 0.0;
+        double p95Ms    = 0.0;
+        double maxMs    = 0.0;
+    };
+
+    // 프레임(배치는 draw 또는 dispatch 한 번)당 파이프라인 통계 평균.
+    // GL 4.6 또는 ARB_pipeline_statistics_query가 없으면 samples == 0
+    struct PipelineStatistics {
+        std::size_t samples = 0;
+        double vertexInvocations        = 0.0;
+        double fragmentInvocations      = 0.0;
+        double computeInvocations       = 0.0;
+        double clippingInputPrimitives  = 0.0;
+        double clippingOutputPrimitives = 0.0;
+        double gpuMs = 0.0;     // 같은 구간의 GPU 시간 평균 (호출 하나당 비용 계산용)
+    };
+
+    // replayCapture 옵션
+    struct ReplayOptions {
+        int loops = 1;              // 캡처한 프레임 전체를 반복할 횟수
+        std::string imagePath;      // 비어 있지 않으면 마지막 프레임을 PNG로 저장
+    };
+
+    // 셰이더 안의 `// @profile begin/end name` 구간 하나의 clock 측정 결과 (마지막 readback 기준)
+    struct ShaderProfileRegion {
+        std::string name;
+        double cyclesPerCall = 0.0;     // invocation 하나가 구간에서 쓴 평균 사이클
+        double callsPerFrame = 0.0;     // 프레임당 구간을 지난 invocation 수
+        double share = 0.0;             // 전체 구간 사이클 중 비율 (0~1)
+    };
+
     class Engine {
     public:
         // 기본은 OpenGL 백엔드로 동작
@@ -26,9 +93,93 @@ namespace AutoGL {
         void mainLoop(const std::string& shaderPath);
         void setWindowSize(int w, int h);
 
+        // 여러 그래픽 셰이더를 한 창에 격자로 나눠서 동시에 렌더링 (hot reload 포함)
+        // compute 셰이더는 건너뜀
+        void dashboardLoop(const std::vector<std::string>& shaderPaths);
+
+        // initGL 전에 호출해야 컨텍스트 플래그까지 반영됨
+        void setDebugMode(GLDebugMode mode);
+
+        // 프로그램 바이너리 캐시 위치 (빈 문자열이면 캐시 끔)
+        void setProgramCacheDir(const std::string& dir);
+
+        // @variant 값 선택 (빈 값이면 기본값으로 되돌림)
+        // mainLoop 실행 중 다른 스레드에서 호출해도 되며, 다음 프레임에 반영됨
+        void setShaderVariant(const std::string& name, const std::string& value);
+
+        // 사용자 uniform 값 (count 1~4 = float~vec4, int/uint/bool 선언이면 변환해서 씀).
+        // 각 stage에 같은 이름이 있으면 모두 씀. mainLoop 중 다른 스레드에서 호출해도 되며 다음 프레임에 반영
+        void setUniform(const std::string& name, const float* values, int count);
+        void setUniform(const std::string& name, float value);
+
+        // 켜면 stableFrames 프레임 동안 값이 그대로인 사용자 uniform을 const로 바꾼 variant를
+        // 백그라운드에서 빌드해서 교체 (컴파일러가 상수를 접고 루프를 펼 수 있음).
+        // 값이 바뀌면 그 프레임부터 다시 일반 프로그램으로 그림
+        void setUniformSpecialization(bool enabled, int stableFrames = 120);
+
+        // 켜면 (기본) 시간/입력에 의존하지 않는 셰이더는 한 번 그린 뒤 입력, resize,
+        // reload가 있을 때까지 대기하고, 애니메이션 셰이더는 창이 가려지거나
+        // 포커스를 잃으면 프레임 속도를 낮춤. 끄면 항상 매 프레임 그림 (측정용)
+        void setOnDemandRendering(bool enabled);
+
+        // 켜면 iMouse를 persistent 매핑 버퍼로 전달해서 draw 직전의 최신 입력을 쓰고,
+        // GPU보다 한 프레임 넘게 앞서 나가지 않도록 제한 (mainLoop 전에 호출)
+        void setLateLatchInput(bool enabled);
+
+        // 켜면 fragment 호출 수를 픽셀마다 세서 히트맵으로 출력 위에 덮어 그림 (mainLoop 셰이더).
+        // 계측된 프로그램은 variant처럼 따로 빌드/캐시됨. mainLoop 실행 중 다른 스레드에서
+        // 호출해도 되며 다음 프레임에 반영, 창에서는 F2로 토글
+        void setOverdrawHeatmap(bool enabled);
+
+        // 켜면 fragment/compute 섹션의 `// @profile begin name` ... `// @profile end name` 구간을
+        // ARB_shader_clock으로 계측해서 readbackInterval 프레임마다 비동기로 읽고 로그로 출력.
+        // overdraw heatmap처럼 계측된 프로그램은 variant로 따로 빌드되고 mainLoop 중 호출해도 됨
+        void setShaderProfiling(bool enabled, int readbackInterval = 120);
+
+        // 마지막으로 읽은 구간별 결과, 다른 스레드에서 호출 가능
+        std::vector<ShaderProfileRegion> shaderProfile() const;
+
+        // mainLoop에서 다음에 그리는 프레임부터 frames 프레임 동안의 GL 호출과, 그 호출이 참조하는
+        // 버퍼/텍스처/프로그램 내용을 path에 기록 (캡처 중에는 정적 셰이더도 매 프레임 그림).
+        // 다른 스레드에서 호출해도 되며 다음 프레임에 시작
+        void setCommandCapture(const std::string& path, int frames = 1);
+
+        // setCommandCapture로 만든 파일을 숨김 창에서 swap 없이 최대한 빨리 다시 실행하고
+        // 프레임 시간을 로그로 출력. 프로그램이 드라이버 바이너리로 들어 있어 같은 드라이버에서만 재생됨
+        bool replayCapture(const std::string& path, const ReplayOptions& opts);
+
+        // 그래픽 셰이더를 인스턴스 count개로 그림 (0이면 파일의 @instances N 사용).
+        // 버텍스 셰이더는 gl_InstanceID로 std430 SSBO 배열에서 인스턴스 데이터를 읽고,
+        // 크기를 정하지 않은 배열은 인스턴스 수만큼 자동 할당됨 (mainLoop 셰이더에 적용)
+        void setInstanceCount(int count);
+
+        // binding 번호의 SSBO에 인스턴스 데이터를 씀 (필요하면 버퍼를 키움)
+        // mainLoop 실행 중 다른 스레드에서 호출해도 되며, 다음 프레임에 반영됨
+        void setInstanceData(int binding, const void* data, std::size_t bytes);
+
+        // mainLoop 중 측정한 입력→present 지연, 다른 스레드에서 호출 가능
+        InputLatencyStats inputLatency() const;
+
+        // mainLoop 중 최근 프레임의 파이프라인 통계, 다른 스레드에서 호출 가능
+        PipelineStatistics pipelineStatistics() const;
+
         std::vector<ShaderFile> scanShaderFolder(const std::string& folder);
+
+        // 찾은 셰이더를 여러 컨텍스트에서 병렬로 컴파일하고, 고정 iTime으로 한 프레임씩
+        // 아틀라스 한 장에 그려서 이미지 + JSON 인덱스로 저장
+        // initGL 전에 호출하면 숨김 창으로 컨텍스트를 만듦
+        std::vector<ShaderFile> scanShaderFolder(const std::string& folder,
+                                                 const ThumbnailAtlasOptions& atlas);
         bool runShaderFile(const std::string& path);
 
+        // 셰이더마다 전처리/컴파일/링크/첫 프레임 시간과 GPU 프레임(dispatch) 시간을
+        // 숨김 창에서 측정해서 리포트 하나로 출력. 하나라도 실패하면 false
+        bool runBatch(const std::vector<std::string>& shaderPaths, const BatchOptions& opts);
+
+        // 두 셰이더를 숨김 창에서 같은 해상도/고정 입력으로 배치를 번갈아 그려 GPU 시간을 비교.
+        // b가 a보다 몇 배 빠른지 (배치 median 비율)와 bootstrap 신뢰구간, Mann-Whitney p값을 로그로 출력
+        bool runABTest(const std::string& pathA, const std::string& pathB, const ABTestOptions& opts);
+
         BackendAPI backend() const noexcept;
 
     private:
@@ -7,6 +7,8 @@
 #include "vk_engine.hpp"
 #include "glsl_loader.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <filesystem>
 #include <iostream>
 
@@ -62,16 +64,125 @@ namespace AutoGL {
         pimpl->backend->mainLoop(shaderPath);
     }
 
+    void Engine::dashboardLoop(const std::vector<std::string>& shaderPaths) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->dashboardLoop(shaderPaths);
+    }
+
     void Engine::setWindowSize(int w, int h) {
         if (!pimpl || !pimpl->backend) return;
         pimpl->backend->setWindowSize(w, h);
     }
 
+    void Engine::setDebugMode(GLDebugMode mode) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setDebugMode(mode);
+    }
+
+    void Engine::setProgramCacheDir(const std::string& dir) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setProgramCacheDir(dir);
+    }
+
+    void Engine::setShaderVariant(const std::string& name, const std::string& value) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setShaderVariant(name, value);
+    }
+
+    void Engine::setUniform(const std::string& name, const float* values, int count) {
+        if (!pimpl || !pimpl->backend) return;
+
+        // 특수화할 때 정규식/define 이름으로 그대로 쓰므로 식별자만 받음
+        const bool identifier = !name.empty() && !std::isdigit(static_cast<unsigned char>(name[0])) &&
+            std::all_of(name.begin(), name.end(), [](char c) {
+                return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+            });
+        if (!identifier || !values || count < 1 || count > 4) {
+            AUTOGL_LOG_ERROR("AutoGL", "setUniform: invalid uniform " + name);
+            return;
+        }
+        pimpl->backend->setUniform(name, std::vector<float>(values, values + count));
+    }
+
+    void Engine::setUniform(const std::string& name, float value) {
+        setUniform(name, &value, 1);
+    }
+
+    void Engine::setUniformSpecialization(bool enabled, int stableFrames) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setUniformSpecialization(enabled, stableFrames);
+    }
+
+    void Engine::setOnDemandRendering(bool enabled) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setOnDemandRendering(enabled);
+    }
+
+    void Engine::setLateLatchInput(bool enabled) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setLateLatchInput(enabled);
+    }
+
+    void Engine::setOverdrawHeatmap(bool enabled) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setOverdrawHeatmap(enabled);
+    }
+
+    void Engine::setShaderProfiling(bool enabled, int readbackInterval) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setShaderProfiling(enabled, readbackInterval);
+    }
+
+    std::vector<ShaderProfileRegion> Engine::shaderProfile() const {
+        if (!pimpl || !pimpl->backend) return {};
+        return pimpl->backend->shaderProfile();
+    }
+
+    void Engine::setCommandCapture(const std::string& path, int frames) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setCommandCapture(path, frames);
+    }
+
+    bool Engine::replayCapture(const std::string& path, const ReplayOptions& opts) {
+        if (!pimpl || !pimpl->backend) return false;
+        return pimpl->backend->replayCapture(path, opts);
+    }
+
+    void Engine::setInstanceCount(int count) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setInstanceCount(count);
+    }
+
+    void Engine::setInstanceData(int binding, const void* data, std::size_t bytes) {
+        if (!pimpl || !pimpl->backend) return;
+        pimpl->backend->setInstanceData(binding, data, bytes);
+    }
+
+    PipelineStatistics Engine::pipelineStatistics() const {
+        if (!pimpl || !pimpl->backend) return {};
+        return pimpl->backend->pipelineStatistics();
+    }
+
+    InputLatencyStats Engine::inputLatency() const {
+        if (!pimpl || !pimpl->backend) return {};
+        return pimpl->backend->inputLatency();
+    }
+
     bool Engine::runShaderFile(const std::string& path) {
         if (!pimpl || !pimpl->backend) return false;
         return pimpl->backend->runShaderFile(path);
     }
 
+    bool Engine::runBatch(const std::vector<std::string>& shaderPaths, const BatchOptions& opts) {
+        if (!pimpl || !pimpl->backend) return false;
+        return pimpl->backend->runBatch(shaderPaths, opts);
+    }
+
+    bool Engine::runABTest(const std::string& pathA, const std::string& pathB, const ABTestOptions& opts) {
+        if (!pimpl || !pimpl->backend) return false;
+        return pimpl->backend->runABTest(pathA, pathB, opts);
+    }
+
     std::vector<ShaderFile> Engine::scanShaderFolder(const std::string& folder) {
         std::vector<ShaderFile> shaders;
 
@@ -100,6 +211,23 @@ namespace AutoGL {
         return shaders;
     }
 
+    std::vector<ShaderFile> Engine::scanShaderFolder(const std::string& folder,
+                                                     const ThumbnailAtlasOptions& atlas) {
+        std::vector<ShaderFile> shaders = scanShaderFolder(folder);
+        if (shaders.empty() || !pimpl || !pimpl->backend) return shaders;
+
+        // 아틀라스 타일 순서가 실행마다 같도록 경로순 정렬
+        std::sort(shaders.begin(), shaders.end(),
+            [](const ShaderFile& a, const ShaderFile& b) { return a.path < b.path; });
+
+        std::vector<std::string> paths;
+        paths.reserve(shaders.size());
+        for (const auto& sf : shaders) paths.push_back(sf.path);
+
+        pimpl->backend->renderThumbnailAtlas(paths, atlas);
+        return shaders;
+    }
+
     BackendAPI Engine::backend() const noexcept {
         if (!pimpl) return BackendAPI::OpenGL;
         return pimpl->api;
@@ -2,16 +2,106 @@
 #pragma once
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "gl_state_cache.hpp"
+#include "thread_sync.hpp"
+
 namespace AutoGL {
 
+    // 프로그램 교체 시 한 번만 조회하는 builtin uniform 위치 (-1 = 미사용)
+    struct BuiltinUniformLocations {
+        GLint iTime       = -1;
+        GLint iTimeDelta  = -1;
+        GLint iFrame      = -1;
+        GLint iGlobalTime = -1;
+        GLint iResolution = -1;
+        GLint iMouse      = -1;
+        GLint iDate       = -1;
+        GLint iFrameRate  = -1;
+        GLint iRandom     = -1;
+        GLint iChannelResolution[4] = {-1, -1, -1, -1};
+        GLint iChannelTime[4]       = {-1, -1, -1, -1};
+        GLint iMouseBlock = -1;     // late-latch 모드에서 iMouse를 담은 uniform block 인덱스
+        GLint iMeshIndexCount = -1; // @mesh 인덱스 수 (quad면 6), indirect 명령을 채우는 compute용
+
+        // 프레임마다 값이 바뀌는 uniform을 쓰는지 (안 쓰면 이벤트가 있을 때만 다시 그려도 됨)
+        bool usesTime() const noexcept {
+            if (iTime >= 0 || iTimeDelta >= 0 || iFrame >= 0 || iGlobalTime >= 0 ||
+                iDate >= 0 || iFrameRate >= 0 || iRandom >= 0) {
+                return true;
+            }
+            for (GLint loc : iChannelTime) {
+                if (loc >= 0) return true;
+            }
+            return false;
+        }
+
+        bool usesMouse() const noexcept { return iMouse >= 0 || iMouseBlock >= 0; }
+    };
+
+    // 프레임마다 한 번 계산해서 여러 프로그램에 그대로 올리는 builtin 값
+    // (대시보드는 타일마다 resolution/mouse만 바꿔서 사용)
+    struct BuiltinUniformValues {
+        float time      = 0.0f;
+        float timeDelta = 0.0f;
+        float frameRate = 0.0f;
+        float random    = 0.0f;
+        int   frame     = 0;
+
+        float resolution[2] = {0.0f, 0.0f};
+        float mouse[4]      = {0.0f, 0.0f, 0.0f, 0.0f};
+        float date[4]       = {0.0f, 0.0f, 0.0f, 0.0f};
+
+        float channelResolution[4][3] = {};
+        float channelTime[4]          = {0.0f, 0.0f, 0.0f, 0.0f};
+    };
+
+    // 이벤트(메인) 스레드가 GLFW 콜백에서 채워서 발행하는 입력 상태.
+    // 렌더 스레드는 프레임 시작에 한 번 복사해서 씀 (serial이 바뀌었으면 새 입력/redraw 요청)
+    struct InputSnapshot {
+        double mouseX = 0.0;
+        double mouseY = 0.0;
+        double clickX = 0.0;
+        double clickY = 0.0;
+        int fbWidth   = 0;
+        int fbHeight  = 0;
+        bool mouseDown = false;
+        bool focused   = true;
+        bool hidden    = false;     // 최소화 또는 숨김 창
+        double inputTime = 0.0;     // 마지막 마우스 입력 시각 (glfwGetTime, 지연 측정용)
+
+        std::uint32_t inputSerial  = 0;     // 마우스 이동/클릭마다 증가
+        std::uint32_t redrawSerial = 0;     // resize, expose, 최소화 상태 변경마다 증가
+        std::uint32_t heatmapToggles = 0;   // F2를 누를 때마다 증가
+    };
+
     struct InternalGLState {
         GLFWwindow* window = nullptr;
         int width  = 800;
         int height = 600;
 
+        // 콜백은 eventInput만 고치고 input으로 발행 (메인 스레드 전용),
+        // 렌더 스레드는 input을 읽고 wake로 깨어남. 아래 mouse/fb 필드는 렌더 스레드 쪽 사본
+        InputSnapshot eventInput;
+        SeqLock<InputSnapshot> input;
+        WakeEvent wake;
+        std::uint32_t seenInputSerial  = 0;
+        std::uint32_t seenRedrawSerial = 0;
+        std::uint32_t seenHeatmapToggles = 0;
+        bool heatmapToggled = false;    // 마지막 확인 이후 F2가 홀수 번 눌림
+        bool focused = true;
+        bool hidden  = false;
+
+        // framebuffer 크기 (렌더 스레드가 입력 스냅샷에서 갱신)
+        int fbWidth  = 0;
+        int fbHeight = 0;
+
+        // 중복 바인딩 제거용 상태 캐시
+        GLStateCache glState;
+
         // fullscreen quad
         unsigned int quadVAO = 0;
         unsigned int quadVBO = 0;
@@ -32,6 +122,11 @@ namespace AutoGL {
 
         double clickX = 0.0;
         double clickY = 0.0;
+        double inputTime = 0.0;
+
+        // on-demand 렌더링: 입력 스냅샷/프로그램 교체가 세우고 렌더 루프가 그린 뒤 내림
+        bool redrawRequested = true;    // resize, expose, 프로그램 교체
+        bool inputChanged    = false;   // 마우스 이동/클릭 (iMouse를 쓰는 셰이더만 다시 그림)
 
         // shadertoy style channels
         unsigned int textures[4] = {0, 0, 0, 0};
@@ -44,3 +139,10 @@ namespace AutoGL {
     };
 
 } // namespace AutoGL
+
+namespace AutoGL::detail {
+
+    // fullscreen quad VAO/VBO (location 0 = aPos, 1 = aUV). 렌더 창과 컴파일 워커의 warm-up이 같은 레이아웃을 씀
+    void createQuadBuffers(GLuint& vao, GLuint& vbo);
+
+} // namespace AutoGL::detail
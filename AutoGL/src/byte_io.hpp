@@ -0,0 +1,67 @@
+// src/byte_io.hpp
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace AutoGL::detail {
+
+    // 바이너리 파일(프로그램 캐시, 명령 캡처)용 직렬화 헬퍼. 값은 host byte order 그대로 씀
+    class ByteWriter {
+    public:
+        void u8(std::uint8_t v)   { raw(&v, 1); }
+        void u32(std::uint32_t v) { raw(&v, sizeof(v)); }
+        void i32(std::int32_t v)  { raw(&v, sizeof(v)); }
+        void u64(std::uint64_t v) { raw(&v, sizeof(v)); }
+        void f32(float v)         { raw(&v, sizeof(v)); }
+        void str(const std::string& s) {
+            u32(static_cast<std::uint32_t>(s.size()));
+            raw(s.data(), s.size());
+        }
+        void raw(const void* p, std::size_t n) {
+            const auto* b = static_cast<const char*>(p);
+            buf.insert(buf.end(), b, b + n);
+        }
+
+        std::vector<char> buf;
+    };
+
+    class ByteReader {
+    public:
+        ByteReader(const char* data, std::size_t size) : p_(data), end_(data + size) {}
+
+        bool ok() const noexcept { return ok_; }
+        bool atEnd() const noexcept { return p_ == end_; }
+
+        std::uint8_t  u8()  { std::uint8_t v = 0;  raw(&v, 1);         return v; }
+        std::uint32_t u32() { std::uint32_t v = 0; raw(&v, sizeof(v)); return v; }
+        std::int32_t  i32() { std::int32_t v = 0;  raw(&v, sizeof(v)); return v; }
+        std::uint64_t u64() { std::uint64_t v = 0; raw(&v, sizeof(v)); return v; }
+        float         f32() { float v = 0.0f;      raw(&v, sizeof(v)); return v; }
+        std::string str() {
+            std::uint32_t n = u32();
+            if (!ok_ || static_cast<std::size_t>(end_ - p_) < n) { ok_ = false; return {}; }
+            std::string s(p_, n);
+            p_ += n;
+            return s;
+        }
+        const char* take(std::size_t n) {
+            if (!ok_ || static_cast<std::size_t>(end_ - p_) < n) { ok_ = false; return nullptr; }
+            const char* at = p_;
+            p_ += n;
+            return at;
+        }
+
+    private:
+        void raw(void* out, std::size_t n) {
+            const char* at = take(n);
+            if (at) std::memcpy(out, at, n);
+        }
+
+        const char* p_;
+        const char* end_;
+        bool ok_ = true;
+    };
+
+} // namespace AutoGL::detail
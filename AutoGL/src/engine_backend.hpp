@@ -1,6 +1,7 @@
 // src/engine_backend.hpp
 #pragma once
 #include <string>
+#include <vector>
 #include <AutoGL/AutoGL.hpp>
 
 namespace AutoGL {
@@ -11,9 +12,32 @@ namespace AutoGL {
 
         virtual bool init() = 0;
         virtual void setWindowSize(int w, int h) = 0;
+        virtual void setDebugMode(GLDebugMode mode) = 0;
+        virtual void setProgramCacheDir(const std::string& dir) = 0;
+        virtual void setShaderVariant(const std::string& name, const std::string& value) = 0;
+        virtual void setOnDemandRendering(bool enabled) = 0;
+        virtual void setLateLatchInput(bool enabled) = 0;
+        virtual void setOverdrawHeatmap(bool enabled) = 0;
+        virtual void setUniform(const std::string& name, const std::vector<float>& value) = 0;
+        virtual void setUniformSpecialization(bool enabled, int stableFrames) = 0;
+        virtual void setShaderProfiling(bool enabled, int readbackInterval) = 0;
+        virtual std::vector<ShaderProfileRegion> shaderProfile() const = 0;
+        virtual void setCommandCapture(const std::string& path, int frames) = 0;
+        virtual void setInstanceCount(int count) = 0;
+        virtual void setInstanceData(int binding, const void* data, std::size_t bytes) = 0;
+        virtual InputLatencyStats inputLatency() const = 0;
+        virtual PipelineStatistics pipelineStatistics() const = 0;
 
         virtual void mainLoop(const std::string& shaderPath) = 0;
+        virtual void dashboardLoop(const std::vector<std::string>& shaderPaths) = 0;
         virtual bool runShaderFile(const std::string& path) = 0;
+        virtual bool renderThumbnailAtlas(const std::vector<std::string>& shaderPaths,
+                                          const ThumbnailAtlasOptions& opts) = 0;
+        virtual bool runBatch(const std::vector<std::string>& shaderPaths,
+                              const BatchOptions& opts) = 0;
+        virtual bool runABTest(const std::string& pathA, const std::string& pathB,
+                               const ABTestOptions& opts) = 0;
+        virtual bool replayCapture(const std::string& path, const ReplayOptions& opts) = 0;
     };
 
 } // namespace AutoGL
\ No newline at end of file
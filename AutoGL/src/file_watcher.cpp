@@ -0,0 +1,240 @@
+// src/file_watcher.cpp
+#include "file_watcher.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <filesystem>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace AutoGL {
+
+    namespace {
+        // 이벤트의 dir + name 과 비교할 수 있도록 절대 경로로 정규화
+        std::string normalizePath(const std::string& path) {
+            std::error_code ec;
+            fs::path p = fs::absolute(path, ec);
+            if (ec) return path;
+            return p.lexically_normal().string();
+        }
+
+        constexpr auto kPollInterval = std::chrono::milliseconds(200);
+    }
+
+    FileWatcher::~FileWatcher() {
+        stop();
+    }
+
+    void FileWatcher::addFile(const std::string& path) {
+        const std::string file = normalizePath(path);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!files_.insert(file).second) return;
+
+        stamps_[file] = statFile(file);
+#if defined(__linux__)
+        if (inotifyFd_ >= 0) {
+            addWatchLocked(file);
+        }
+#endif
+    }
+
+    bool FileWatcher::start() {
+        if (running_.load()) return true;
+
+#if defined(__linux__)
+        if (initInotify()) {
+            running_.store(true);
+            thread_ = std::thread([this] { runInotify(); });
+            return true;
+        }
+        AUTOGL_LOG_WARN("FileWatcher", "inotify unavailable, falling back to polling");
+#endif
+        running_.store(true);
+        thread_ = std::thread([this] { runPolling(); });
+        return true;
+    }
+
+    void FileWatcher::stop() {
+        if (!running_.exchange(false)) return;
+
+#if defined(__linux__)
+        if (wakePipe_[1] >= 0) {
+            const char c = 0;
+            ssize_t ignored = write(wakePipe_[1], &c, 1);
+            (void)ignored;
+        }
+#endif
+        if (thread_.joinable()) thread_.join();
+
+#if defined(__linux__)
+        if (inotifyFd_ >= 0) close(inotifyFd_);
+        if (wakePipe_[0] >= 0) close(wakePipe_[0]);
+        if (wakePipe_[1] >= 0) close(wakePipe_[1]);
+        inotifyFd_ = -1;
+        wakePipe_[0] = wakePipe_[1] = -1;
+        watchDirs_.clear();
+#endif
+    }
+
+    std::vector<std::string> FileWatcher::takeChanges() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        changed_.store(false, std::memory_order_release);
+
+        std::vector<std::string> out(changedFiles_.begin(), changedFiles_.end());
+        changedFiles_.clear();
+        return out;
+    }
+
+    int FileWatcher::flushPendingLocked(Clock::time_point now) {
+        int waitMs = -1;
+        bool any = false;
+
+        for (auto it = pending_.begin(); it != pending_.end();) {
+            auto quiet = now - it->second;
+            if (quiet >= debounce_) {
+                changedFiles_.insert(it->first);
+                it = pending_.erase(it);
+                any = true;
+                continue;
+            }
+
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(debounce_ - quiet);
+            int ms = static_cast<int>(left.count()) + 1;
+            if (waitMs < 0 || ms < waitMs) waitMs = ms;
+            ++it;
+        }
+
+        if (any) {
+            changed_.store(true, std::memory_order_release);
+            if (onChange_) onChange_();
+        }
+        return waitMs;
+    }
+
+    FileWatcher::FileStamp FileWatcher::statFile(const std::string& path) {
+        FileStamp st;
+        std::error_code ec;
+
+        auto t = fs::last_write_time(path, ec);
+        if (ec) return st;
+
+        st.size   = fs::file_size(path, ec);
+        st.mtime  = std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch());
+        st.exists = !ec;
+        return st;
+    }
+
+    void FileWatcher::runPolling() {
+        while (running_.load()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                const auto now = Clock::now();
+
+                for (const auto& file : files_) {
+                    FileStamp st = statFile(file);
+                    FileStamp& prev = stamps_[file];
+
+                    if (st.exists != prev.exists || st.mtime != prev.mtime || st.size != prev.size) {
+                        prev = st;
+                        // 아직 쓰는 중일 수 있으므로 다음 폴링까지 안정되는지 기다림
+                        if (st.exists) pending_[file] = now;
+                    }
+                }
+
+                flushPendingLocked(now);
+            }
+
+            std::this_thread::sleep_for(kPollInterval);
+        }
+    }
+
+#if defined(__linux__)
+    bool FileWatcher::initInotify() {
+        inotifyFd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd_ < 0) return false;
+
+        if (pipe(wakePipe_) != 0) {
+            close(inotifyFd_);
+            inotifyFd_ = -1;
+            return false;
+        }
+        fcntl(wakePipe_[0], F_SETFL, O_NONBLOCK);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& file : files_) {
+            addWatchLocked(file);
+        }
+        return true;
+    }
+
+    void FileWatcher::addWatchLocked(const std::string& file) {
+        const std::string dir = fs::path(file).parent_path().string();
+
+        for (const auto& [wd, d] : watchDirs_) {
+            if (d == dir) return;
+        }
+
+        // 파일이 아니라 디렉토리를 감시: rename 저장 시 원본 inode가 사라져도 추적 가능
+        int wd = inotify_add_watch(inotifyFd_, dir.c_str(),
+            IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE | IN_ATTRIB);
+        if (wd < 0) {
+            AUTOGL_LOG_WARN("FileWatcher", "inotify_add_watch failed for " + dir);
+            return;
+        }
+        watchDirs_[wd] = dir;
+    }
+
+    void FileWatcher::runInotify() {
+        alignas(struct inotify_event) char buf[4096];
+        int timeoutMs = -1;
+
+        while (running_.load()) {
+            pollfd fds[2] = {
+                { inotifyFd_,  POLLIN, 0 },
+                { wakePipe_[0], POLLIN, 0 }
+            };
+
+            int rc = poll(fds, 2, timeoutMs);
+            if (!running_.load()) break;
+            if (rc < 0) continue;
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto now = Clock::now();
+
+            if (fds[0].revents & POLLIN) {
+                for (;;) {
+                    ssize_t n = read(inotifyFd_, buf, sizeof(buf));
+                    if (n <= 0) break;
+
+                    for (char* p = buf; p < buf + n;) {
+                        auto* ev = reinterpret_cast<inotify_event*>(p);
+                        p += sizeof(inotify_event) + ev->len;
+
+                        if (ev->len == 0) continue;
+
+                        auto dirIt = watchDirs_.find(ev->wd);
+                        if (dirIt == watchDirs_.end()) continue;
+
+                        std::string file = (fs::path(dirIt->second) / ev->name).string();
+                        if (files_.count(file) == 0) continue;
+
+                        // IN_MODIFY는 쓰는 중에도 계속 오므로 디바운스 타이머만 연장
+                        pending_[file] = now;
+                    }
+                }
+            }
+
+            timeoutMs = flushPendingLocked(now);
+        }
+    }
+#endif
+
+} // namespace AutoGL
@@ -0,0 +1,90 @@
+// src/file_watcher.hpp
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace AutoGL {
+
+    // 셰이더 파일 변경 감시 스레드.
+    // Linux에서는 파일이 있는 디렉토리를 inotify로 감시해서 rename 저장
+    // (임시 파일 작성 후 교체)도 잡고, 그 외 플랫폼이나 inotify 실패 시
+    // stat 폴링으로 대체한다. 렌더 스레드는 hasChanges()의 atomic 플래그만 읽는다.
+    class FileWatcher {
+    public:
+        FileWatcher() = default;
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        // start 전후 모두 호출 가능
+        void addFile(const std::string& path);
+
+        // 마지막 이벤트 이후 이 시간 동안 조용해야 변경으로 인정 (부분 쓰기 방지)
+        void setDebounce(std::chrono::milliseconds ms) { debounce_ = ms; }
+
+        // 변경이 확정될 때 감시 스레드에서 호출 (렌더 루프를 깨우는 용도, start 전에 설정)
+        void setOnChange(std::function<void()> fn) { onChange_ = std::move(fn); }
+
+        bool start();
+        void stop();
+
+        // 렌더 루프용: 파일시스템 호출 없이 atomic load 한 번
+        bool hasChanges() const noexcept {
+            return changed_.load(std::memory_order_acquire);
+        }
+
+        // 바뀐 파일 목록을 가져오고 플래그를 내림
+        std::vector<std::string> takeChanges();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        struct FileStamp {
+            std::chrono::nanoseconds mtime{0};
+            std::uintmax_t size = 0;
+            bool exists = false;
+        };
+
+        std::mutex mutex_;
+        std::unordered_set<std::string> files_;
+        std::unordered_set<std::string> changedFiles_;
+        std::atomic<bool> changed_{false};
+
+        // 디바운스 대기 중인 파일 -> 마지막 이벤트 시각
+        std::unordered_map<std::string, Clock::time_point> pending_;
+
+        std::function<void()> onChange_;
+
+        std::chrono::milliseconds debounce_{75};
+        std::atomic<bool> running_{false};
+        std::thread thread_;
+
+#if defined(__linux__)
+        int inotifyFd_ = -1;
+        int wakePipe_[2] = {-1, -1};
+        std::unordered_map<int, std::string> watchDirs_;   // wd -> dir
+
+        bool initInotify();
+        void addWatchLocked(const std::string& file);
+        void runInotify();
+#endif
+        std::unordered_map<std::string, FileStamp> stamps_;
+
+        static FileStamp statFile(const std::string& path);
+        void runPolling();
+
+        // pending_ 중 디바운스가 끝난 항목을 changedFiles_로 옮김
+        // 반환값: 다음 확인까지 남은 시간 (대기 없으면 -1)
+        int flushPendingLocked(Clock::time_point now);
+    };
+
+} // namespace AutoGL
@@ -0,0 +1,201 @@
+// src/gl_async_compiler.cpp
+#include "gl_async_compiler.hpp"
+#include "gl_ext.hpp"
+#include "autogl_internal.hpp"
+
+#include <AutoGL/Log.hpp>
+
+namespace AutoGL {
+
+    AsyncShaderCompiler::~AsyncShaderCompiler() {
+        shutdown();
+    }
+
+    bool AsyncShaderCompiler::init(GLFWwindow* shareWith, int workerCount) {
+        if (!shareWith || available()) return available();
+
+        // 공유 컨텍스트용 숨김 창 (컨텍스트 버전/디버그 hint는 렌더 창과 동일하게 유지)
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+        for (int i = 0; i < workerCount; ++i) {
+            GLFWwindow* ctx = glfwCreateWindow(1, 1, "AutoGL Compiler", nullptr, shareWith);
+            if (!ctx) {
+                AUTOGL_LOG_WARN("AsyncCompiler", "shared context creation failed");
+                break;
+            }
+
+            Worker w;
+            w.context = ctx;
+            workers_.push_back(std::move(w));
+        }
+
+        glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+        if (workers_.empty()) {
+            AUTOGL_LOG_WARN("AsyncCompiler",
+                "background compilation disabled, shaders compile on the render thread");
+            return false;
+        }
+
+        // workers_는 여기서부터 크기가 바뀌지 않으므로 원소 참조를 스레드에 넘겨도 됨
+        for (auto& w : workers_) {
+            w.thread = std::thread([this, &w] { workerLoop(w); });
+        }
+
+        AUTOGL_LOG_INFO("AsyncCompiler",
+            "background compilation enabled (" + std::to_string(workers_.size()) + " worker"
+            + (workers_.size() > 1 ? "s" : "") + ")");
+        return true;
+    }
+
+    void AsyncShaderCompiler::shutdown() {
+        if (workers_.empty()) return;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            queue_.clear();
+        }
+        cv_.notify_all();
+
+        for (auto& w : workers_) {
+            if (w.thread.joinable()) w.thread.join();
+        }
+
+        // 받아가지 않은 결과 정리 (렌더 컨텍스트가 current인 스레드에서 호출됨)
+        for (auto& d : done_) {
+            if (d.fence) glDeleteSync(d.fence);
+            if (d.result.program.program) glDeleteProgram(d.result.program.program);
+        }
+        done_.clear();
+        completed_.store(0);
+
+        for (auto& w : workers_) {
+            glfwDestroyWindow(w.context);
+        }
+        workers_.clear();
+        stopping_ = false;
+    }
+
+    std::uint64_t AsyncShaderCompiler::submit(const std::string& key, BuildFn fn) {
+        std::uint64_t ticket = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ticket = nextTicket_++;
+
+            bool replaced = false;
+            for (auto& job : queue_) {
+                if (job.key == key) {
+                    job.ticket = ticket;
+                    job.fn     = std::move(fn);
+                    replaced   = true;
+                    break;
+                }
+            }
+
+            if (!replaced) {
+                queue_.push_back(Job{ ticket, key, std::move(fn) });
+            }
+        }
+        cv_.notify_one();
+        return ticket;
+    }
+
+    bool AsyncShaderCompiler::poll(Result& out) {
+        if (!hasResults()) return false;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (done_.empty()) return false;
+
+        Done& front = done_.front();
+        if (front.fence) {
+            // 타임아웃 0: 아직 GPU 쪽 작업이 안 끝났으면 다음 프레임에 다시 확인
+            GLenum rc = glClientWaitSync(front.fence, 0, 0);
+            if (rc != GL_ALREADY_SIGNALED && rc != GL_CONDITION_SATISFIED) {
+                return false;
+            }
+            glDeleteSync(front.fence);
+        }
+
+        out = std::move(front.result);
+        done_.pop_front();
+        completed_.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t AsyncShaderCompiler::pending() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size() + running_;
+    }
+
+    void AsyncShaderCompiler::workerLoop(Worker& worker) {
+        glfwMakeContextCurrent(worker.context);
+        GL::EnableParallelShaderCompile();
+        WarmUpObjects& warm = worker.warmUp;
+
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (stopping_) break;
+
+                job = std::move(queue_.front());
+                queue_.pop_front();
+                ++running_;
+            }
+
+            Done done;
+            done.result.ticket  = job.ticket;
+            done.result.key     = job.key;
+            done.result.program = job.fn();
+            if (warmUpGraphics_ && done.result.program.stages.valid()) {
+                warmUpStages(done.result.program.stages, warm);
+            }
+
+            // 렌더 컨텍스트에서 기다릴 수 있도록 fence 후 flush
+            done.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glFlush();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --running_;
+                if (stopping_) {
+                    glDeleteSync(done.fence);
+                    if (done.result.program.program) glDeleteProgram(done.result.program.program);
+                    break;
+                }
+                done_.push_back(std::move(done));
+            }
+            completed_.fetch_add(1, std::memory_order_release);
+            if (onComplete_) onComplete_();
+        }
+
+        // 컨텍스트가 파괴되기 전에 이 컨텍스트 전용 객체 삭제 (shutdown이 join 뒤에 창을 지움)
+        if (warm.pipeline) glDeleteProgramPipelines(1, &warm.pipeline);
+        if (warm.vao) glDeleteVertexArrays(1, &warm.vao);
+        if (warm.vbo) glDeleteBuffers(1, &warm.vbo);
+        warm = {};
+
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    // 렌더 창과 같은 vertex 레이아웃을 써야 같은 variant가 만들어진다
+    void AsyncShaderCompiler::warmUpStages(const GraphicsStages& stages, WarmUpObjects& warm) {
+        if (warm.vao == 0) {
+            detail::createQuadBuffers(warm.vao, warm.vbo);
+            glCreateProgramPipelines(1, &warm.pipeline);
+        }
+
+        glUseProgramStages(warm.pipeline, GL_VERTEX_SHADER_BIT,   stages.vertex);
+        glUseProgramStages(warm.pipeline, GL_FRAGMENT_SHADER_BIT, stages.fragment);
+
+        glBindProgramPipeline(warm.pipeline);
+        glBindVertexArray(warm.vao);
+        glViewport(0, 0, 1, 1);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glBindVertexArray(0);
+        glBindProgramPipeline(0);
+    }
+
+} // namespace AutoGL
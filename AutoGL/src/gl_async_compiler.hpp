@@ -0,0 +1,113 @@
+// src/gl_async_compiler.hpp
+#pragma once
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "glsl_loader.hpp"
+
+namespace AutoGL {
+
+    // 렌더 컨텍스트와 리소스를 공유하는 숨김 컨텍스트에서 셰이더를 빌드하는 워커.
+    // 렌더 스레드는 이전 프로그램으로 계속 그리다가, 링크가 끝나고 fence가
+    // signal된 결과만 poll()로 받아서 프레임 경계에서 교체한다.
+    //
+    // 주의: 컨텍스트 상태(SSBO binding 등)는 공유되지 않으므로 작업 함수 안에서
+    // 바인딩한 상태는 렌더 컨텍스트에 반영되지 않는다.
+    class AsyncShaderCompiler {
+    public:
+        using BuildFn = std::function<LoadedShaderProgram()>;
+
+        struct Result {
+            std::uint64_t ticket = 0;
+            std::string key;
+            LoadedShaderProgram program;
+        };
+
+        AsyncShaderCompiler() = default;
+        ~AsyncShaderCompiler();
+
+        AsyncShaderCompiler(const AsyncShaderCompiler&) = delete;
+        AsyncShaderCompiler& operator=(const AsyncShaderCompiler&) = delete;
+
+        // 결과가 준비될 때 워커 스레드에서 호출 (렌더 루프를 깨우는 용도, init 전에 설정)
+        void setOnComplete(std::function<void()> fn) { onComplete_ = std::move(fn); }
+
+        // 빌드한 그래픽 stage로 워커 컨텍스트에서 1픽셀 draw를 한 번 해서 드라이버의 지연 컴파일
+        // (첫 draw 때 생성되는 셰이더 variant)을 렌더 스레드 대신 치르게 함 (init 전에 설정)
+        void setWarmUpGraphics(bool enabled) { warmUpGraphics_ = enabled; }
+
+        // 메인 스레드에서 호출 (GLFW 창 생성은 메인 스레드 전용)
+        bool init(GLFWwindow* shareWith, int workerCount = 1);
+        void shutdown();
+
+        bool available() const noexcept { return !workers_.empty(); }
+
+        // 같은 key로 아직 시작하지 않은 요청이 있으면 새 요청으로 대체
+        std::uint64_t submit(const std::string& key, BuildFn fn);
+
+        // 렌더 스레드용: 완료 결과가 있을 가능성이 있는지 (atomic load 한 번)
+        bool hasResults() const noexcept {
+            return completed_.load(std::memory_order_acquire) > 0;
+        }
+
+        // GPU 쪽 링크까지 끝난 결과를 하나 꺼냄
+        bool poll(Result& out);
+
+        // 대기/진행 중인 작업 수
+        std::size_t pending() const;
+
+    private:
+        struct Job {
+            std::uint64_t ticket = 0;
+            std::string key;
+            BuildFn fn;
+        };
+
+        struct Done {
+            Result result;
+            GLsync fence = nullptr;
+        };
+
+        // warm-up draw용 객체. VAO와 pipeline은 컨텍스트 간 공유되지 않으므로 워커마다 따로 두고
+        // 워커 컨텍스트가 current인 동안 (스레드 종료 직전) 삭제
+        struct WarmUpObjects {
+            GLuint vao = 0;
+            GLuint vbo = 0;
+            GLuint pipeline = 0;
+        };
+
+        struct Worker {
+            GLFWwindow* context = nullptr;
+            std::thread thread;
+            WarmUpObjects warmUp;
+        };
+
+        std::vector<Worker> workers_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<Job> queue_;
+        std::deque<Done> done_;
+        std::size_t running_ = 0;
+        std::uint64_t nextTicket_ = 1;
+        bool stopping_ = false;
+
+        std::atomic<std::size_t> completed_{0};
+        std::function<void()> onComplete_;
+        bool warmUpGraphics_ = false;
+
+        void workerLoop(Worker& worker);
+        static void warmUpStages(const GraphicsStages& stages, WarmUpObjects& warm);
+    };
+
+} // namespace AutoGL
@@ -0,0 +1,1622 @@
+// src/gl_capture.cpp
+#include "gl_capture.hpp"
+#include "byte_io.hpp"
+#include "gl_ext.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+
+namespace AutoGL::GL {
+
+    namespace {
+        constexpr char          kCaptureMagic[4] = { 'A', 'G', 'L', 'C' };
+        constexpr std::uint32_t kCaptureVersion  = 1;
+
+        // ---------------- 포맷 헬퍼 ----------------
+
+        int componentsOf(GLenum format) {
+            switch (format) {
+            case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+                return 1;
+            case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+                return 2;
+            case GL_RGB: case GL_RGB_INTEGER: case GL_BGR:
+                return 3;
+            case GL_RGBA: case GL_RGBA_INTEGER: case GL_BGRA:
+                return 4;
+            default:
+                return 0;
+            }
+        }
+
+        int typeBytes(GLenum type) {
+            switch (type) {
+            case GL_UNSIGNED_BYTE: case GL_BYTE:
+                return 1;
+            case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+                return 2;
+            case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+                return 4;
+            default:
+                return 0;
+            }
+        }
+
+        // glClear*Data/glClearTexImage의 data가 가리키는 값 하나의 크기
+        std::size_t clientPixelBytes(GLenum format, GLenum type) {
+            return static_cast<std::size_t>(componentsOf(format) * typeBytes(type));
+        }
+
+        // 텍스처 내용을 읽고 쓸 때의 format/type. 모르는 내부 포맷이면 false (내용 없이 기록)
+        bool transferFormat(GLenum internalFormat, GLenum& format, GLenum& type) {
+            switch (internalFormat) {
+            case GL_RGBA8: case GL_SRGB8_ALPHA8: format = GL_RGBA; type = GL_UNSIGNED_BYTE; return true;
+            case GL_RGBA16F:  format = GL_RGBA;         type = GL_HALF_FLOAT;    return true;
+            case GL_RGBA32F:  format = GL_RGBA;         type = GL_FLOAT;         return true;
+            case GL_RG16F:    format = GL_RG;           type = GL_HALF_FLOAT;    return true;
+            case GL_RG32F:    format = GL_RG;           type = GL_FLOAT;         return true;
+            case GL_R8:       format = GL_RED;          type = GL_UNSIGNED_BYTE; return true;
+            case GL_RG8:      format = GL_RG;           type = GL_UNSIGNED_BYTE; return true;
+            case GL_R16F:     format = GL_RED;          type = GL_HALF_FLOAT;    return true;
+            case GL_R32F:     format = GL_RED;          type = GL_FLOAT;         return true;
+            case GL_R32UI:    format = GL_RED_INTEGER;  type = GL_UNSIGNED_INT;  return true;
+            case GL_R32I:     format = GL_RED_INTEGER;  type = GL_INT;           return true;
+            case GL_RG32UI:   format = GL_RG_INTEGER;   type = GL_UNSIGNED_INT;  return true;
+            case GL_RGBA32UI: format = GL_RGBA_INTEGER; type = GL_UNSIGNED_INT;  return true;
+            case GL_RGBA32I:  format = GL_RGBA_INTEGER; type = GL_INT;           return true;
+            case GL_DEPTH_COMPONENT32F: format = GL_DEPTH_COMPONENT; type = GL_FLOAT; return true;
+            default:
+                return false;
+            }
+        }
+
+        // 기본 블록 uniform 원소 하나: 32비트 값 개수, 기본 타입('f', 'i', 'u'), 행렬이면 열 수
+        struct UniformLayout {
+            int  words   = 0;
+            char base    = 'f';
+            int  columns = 0;
+        };
+
+        UniformLayout uniformLayout(GLenum type) {
+            switch (type) {
+            case GL_FLOAT:      return { 1, 'f', 0 };
+            case GL_FLOAT_VEC2: return { 2, 'f', 0 };
+            case GL_FLOAT_VEC3: return { 3, 'f', 0 };
+            case GL_FLOAT_VEC4: return { 4, 'f', 0 };
+            case GL_INT: case GL_BOOL:           return { 1, 'i', 0 };
+            case GL_INT_VEC2: case GL_BOOL_VEC2: return { 2, 'i', 0 };
+            case GL_INT_VEC3: case GL_BOOL_VEC3: return { 3, 'i', 0 };
+            case GL_INT_VEC4: case GL_BOOL_VEC4: return { 4, 'i', 0 };
+            case GL_UNSIGNED_INT:      return { 1, 'u', 0 };
+            case GL_UNSIGNED_INT_VEC2: return { 2, 'u', 0 };
+            case GL_UNSIGNED_INT_VEC3: return { 3, 'u', 0 };
+            case GL_UNSIGNED_INT_VEC4: return { 4, 'u', 0 };
+            case GL_FLOAT_MAT2:   return { 4,  'f', 2 };
+            case GL_FLOAT_MAT2x3: return { 6,  'f', 2 };
+            case GL_FLOAT_MAT2x4: return { 8,  'f', 2 };
+            case GL_FLOAT_MAT3x2: return { 6,  'f', 3 };
+            case GL_FLOAT_MAT3:   return { 9,  'f', 3 };
+            case GL_FLOAT_MAT3x4: return { 12, 'f', 3 };
+            case GL_FLOAT_MAT4x2: return { 8,  'f', 4 };
+            case GL_FLOAT_MAT4x3: return { 12, 'f', 4 };
+            case GL_FLOAT_MAT4:   return { 16, 'f', 4 };
+            // sampler/image는 unit 번호 (int)
+            case GL_SAMPLER_1D: case GL_SAMPLER_2D: case GL_SAMPLER_3D: case GL_SAMPLER_CUBE:
+            case GL_SAMPLER_2D_ARRAY: case GL_SAMPLER_2D_SHADOW: case GL_SAMPLER_BUFFER:
+            case GL_INT_SAMPLER_2D: case GL_UNSIGNED_INT_SAMPLER_2D:
+            case GL_IMAGE_2D: case GL_IMAGE_3D: case GL_IMAGE_2D_ARRAY: case GL_IMAGE_BUFFER:
+            case GL_INT_IMAGE_2D: case GL_UNSIGNED_INT_IMAGE_2D:
+                return { 1, 'i', 0 };
+            default:
+                return {};      // double 등은 기록하지 않음
+            }
+        }
+
+        // 성분 타입/수에 맞는 glProgramUniform*v (행렬은 columns x (n / columns))
+        void setUniform(GLuint program, GLint location, char base, int n, int columns,
+                        GLsizei count, const void* value) {
+            const auto* f = static_cast<const GLfloat*>(value);
+            const auto* i = static_cast<const GLint*>(value);
+            const auto* u = static_cast<const GLuint*>(value);
+
+            if (columns > 0) {
+                switch (columns * 10 + n / columns) {
+                case 22: glProgramUniformMatrix2fv(program, location, count, GL_FALSE, f);   break;
+                case 23: glProgramUniformMatrix2x3fv(program, location, count, GL_FALSE, f); break;
+                case 24: glProgramUniformMatrix2x4fv(program, location, count, GL_FALSE, f); break;
+                case 32: glProgramUniformMatrix3x2fv(program, location, count, GL_FALSE, f); break;
+                case 33: glProgramUniformMatrix3fv(program, location, count, GL_FALSE, f);   break;
+                case 34: glProgramUniformMatrix3x4fv(program, location, count, GL_FALSE, f); break;
+                case 42: glProgramUniformMatrix4x2fv(program, location, count, GL_FALSE, f); break;
+                case 43: glProgramUniformMatrix4x3fv(program, location, count, GL_FALSE, f); break;
+                case 44: glProgramUniformMatrix4fv(program, location, count, GL_FALSE, f);   break;
+                default: break;
+                }
+                return;
+            }
+
+            switch (base) {
+            case 'f':
+                if (n == 1)      glProgramUniform1fv(program, location, count, f);
+                else if (n == 2) glProgramUniform2fv(program, location, count, f);
+                else if (n == 3) glProgramUniform3fv(program, location, count, f);
+                else if (n == 4) glProgramUniform4fv(program, location, count, f);
+                break;
+            case 'i':
+                if (n == 1)      glProgramUniform1iv(program, location, count, i);
+                else if (n == 2) glProgramUniform2iv(program, location, count, i);
+                else if (n == 3) glProgramUniform3iv(program, location, count, i);
+                else if (n == 4) glProgramUniform4iv(program, location, count, i);
+                break;
+            case 'u':
+                if (n == 1)      glProgramUniform1uiv(program, location, count, u);
+                else if (n == 2) glProgramUniform2uiv(program, location, count, u);
+                else if (n == 3) glProgramUniform3uiv(program, location, count, u);
+                else if (n == 4) glProgramUniform4uiv(program, location, count, u);
+                break;
+            default:
+                break;
+            }
+        }
+
+        // ---------------- 기록 상태 ----------------
+
+        struct Recorder {
+            std::thread::id thread;
+            detail::ByteWriter out;
+            std::size_t records = 0;
+
+            // 이미 Define 레코드를 남긴 이름
+            std::unordered_set<GLuint> buffers;
+            std::unordered_set<GLuint> textures;
+            std::unordered_set<GLuint> programs;
+            std::unordered_set<GLuint> pipelines;
+            std::unordered_set<GLuint> vertexArrays;
+            std::unordered_set<GLuint> framebuffers;
+
+            // persistent 매핑으로 CPU가 GL 호출 없이 쓰는 버퍼 (late-latch 등): 마지막으로 기록한 내용
+            std::unordered_map<GLuint, std::vector<char>> mappedWrites;
+        };
+
+        std::unique_ptr<Recorder> g_owned;
+        std::atomic<Recorder*> g_recorder{nullptr};
+
+        // 캡처 중이고 캡처를 시작한 스레드의 호출이면 기록 대상
+        Recorder* recording() {
+            Recorder* r = g_recorder.load(std::memory_order_acquire);
+            return r && r->thread == std::this_thread::get_id() ? r : nullptr;
+        }
+
+        // [u8 op][u32 크기] 헤더를 쓰고, scope가 끝날 때 크기를 채움
+        class RecordScope {
+        public:
+            RecordScope(Recorder& r, CaptureOp op) : r_(r) {
+                r_.out.u8(static_cast<std::uint8_t>(op));
+                at_ = r_.out.buf.size();
+                r_.out.u32(0);
+                ++r_.records;
+            }
+            ~RecordScope() {
+                const auto size = static_cast<std::uint32_t>(r_.out.buf.size() - at_ - sizeof(std::uint32_t));
+                std::memcpy(r_.out.buf.data() + at_, &size, sizeof(size));
+            }
+            RecordScope(const RecordScope&) = delete;
+            RecordScope& operator=(const RecordScope&) = delete;
+
+        private:
+            Recorder& r_;
+            std::size_t at_ = 0;
+        };
+
+        // 원래 glad 함수 포인터 (래퍼가 기록 후 호출)
+        template <auto& Ptr>
+        struct Hook {
+            static inline std::remove_reference_t<decltype(Ptr)> original = nullptr;
+        };
+
+        // glad를 다시 로드했으면 (포인터가 래퍼가 아니면) 새 포인터를 원래 함수로 잡음.
+        // 캡처가 끝나도 래퍼는 그대로 둠: 다른 스레드가 호출하는 중에 포인터를 되돌리지 않도록
+        template <auto& Ptr, typename Fn>
+        void install(Fn wrapper) {
+            if (!Ptr || Ptr == wrapper) return;
+            Hook<Ptr>::original = Ptr;
+            Ptr = wrapper;
+        }
+
+        // ---------------- Define (처음 참조될 때 현재 내용으로) ----------------
+
+        void ensureBuffer(Recorder& r, GLuint name) {
+            if (!name || !r.buffers.insert(name).second) return;
+
+            GLint64 size = 0;
+            GLint mapped = 0, access = 0, persistent = 0;
+            glGetNamedBufferParameteri64v(name, GL_BUFFER_SIZE, &size);
+            glGetNamedBufferParameteriv(name, GL_BUFFER_MAPPED, &mapped);
+            glGetNamedBufferParameteriv(name, GL_BUFFER_ACCESS_FLAGS, &access);
+            glGetNamedBufferParameteriv(name, GL_BUFFER_STORAGE_FLAGS, &persistent);
+            persistent &= GL_MAP_PERSISTENT_BIT;
+
+            // persistent가 아닌 매핑 중에는 GL로 읽을 수 없음
+            std::vector<char> data(static_cast<std::size_t>(std::max<GLint64>(size, 0)));
+            const bool readable = !mapped || persistent;
+            if (!data.empty() && readable) {
+                glGetNamedBufferSubData(name, 0, static_cast<GLsizeiptr>(size), data.data());
+            } else if (!readable) {
+                AUTOGL_LOG_WARN("Capture", "buffer " + std::to_string(name) + " is mapped, contents not captured");
+            }
+
+            {
+                RecordScope rec(r, CaptureOp::DefineBuffer);
+                r.out.u32(name);
+                r.out.u64(static_cast<std::uint64_t>(data.size()));
+                r.out.raw(data.data(), data.size());
+            }
+            if (mapped && persistent && (access & GL_MAP_WRITE_BIT)) {
+                r.mappedWrites[name] = std::move(data);
+            }
+        }
+
+        // 매핑된 포인터로 쓴 내용은 GL 호출로 보이지 않으므로 draw/dispatch 직전에 비교해서 기록
+        void syncMappedWrites(Recorder& r) {
+            std::vector<char> now;
+            for (auto& [name, last] : r.mappedWrites) {
+                now.resize(last.size());
+                if (now.empty()) continue;
+                glGetNamedBufferSubData(name, 0, static_cast<GLsizeiptr>(now.size()), now.data());
+                if (now == last) continue;
+
+                RecordScope rec(r, CaptureOp::NamedBufferSubData);
+                r.out.u32(name);
+                r.out.u64(0);
+                r.out.u64(static_cast<std::uint64_t>(now.size()));
+                r.out.raw(now.data(), now.size());
+                last.swap(now);
+            }
+        }
+
+        void ensureTexture(Recorder& r, GLuint name) {
+            if (!name || !r.textures.insert(name).second) return;
+
+            GLint target = 0, levels = 0, internalFormat = 0, w = 0, h = 0, d = 0;
+            glGetTextureParameteriv(name, GL_TEXTURE_TARGET, &target);
+            glGetTextureParameteriv(name, GL_TEXTURE_IMMUTABLE_LEVELS, &levels);
+            glGetTextureLevelParameteriv(name, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+            glGetTextureLevelParameteriv(name, 0, GL_TEXTURE_WIDTH, &w);
+            glGetTextureLevelParameteriv(name, 0, GL_TEXTURE_HEIGHT, &h);
+            glGetTextureLevelParameteriv(name, 0, GL_TEXTURE_DEPTH, &d);
+            if (target == GL_TEXTURE_CUBE_MAP) d = 6;   // glGetTextureImage는 면 6개를 이어서 돌려줌
+            levels = std::max(levels, 1);
+
+            GLenum format = 0, type = 0;
+            const bool known = transferFormat(static_cast<GLenum>(internalFormat), format, type);
+            if (!known) {
+                AUTOGL_LOG_WARN("Capture", "texture " + std::to_string(name) +
+                                           " has an unsupported format, contents not captured");
+            }
+
+            RecordScope rec(r, CaptureOp::DefineTexture);
+            r.out.u32(name);
+            r.out.u32(static_cast<std::uint32_t>(target));
+            r.out.u32(static_cast<std::uint32_t>(levels));
+            r.out.u32(static_cast<std::uint32_t>(internalFormat));
+            r.out.i32(w);
+            r.out.i32(h);
+            r.out.i32(d);
+
+            GLint packAlignment = 4;
+            glGetIntegerv(GL_PACK_ALIGNMENT, &packAlignment);
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            std::vector<char> pixels;
+            for (GLint level = 0; level < levels; ++level) {
+                GLint lw = 0, lh = 0, ld = 0;
+                glGetTextureLevelParameteriv(name, level, GL_TEXTURE_WIDTH, &lw);
+                glGetTextureLevelParameteriv(name, level, GL_TEXTURE_HEIGHT, &lh);
+                glGetTextureLevelParameteriv(name, level, GL_TEXTURE_DEPTH, &ld);
+                if (target == GL_TEXTURE_CUBE_MAP) ld = 6;
+
+                pixels.clear();
+                if (known) {
+                    pixels.resize(static_cast<std::size_t>(lw) * static_cast<std::size_t>(std::max(lh, 1)) *
+                                  static_cast<std::size_t>(std::max(ld, 1)) * clientPixelBytes(format, type));
+                    glGetTextureImage(name, level, format, type, static_cast<GLsizei>(pixels.size()), pixels.data());
+                }
+                r.out.u32(static_cast<std::uint32_t>(pixels.size()));
+                r.out.raw(pixels.data(), pixels.size());
+            }
+            glPixelStorei(GL_PACK_ALIGNMENT, packAlignment);
+        }
+
+        void ensureProgram(Recorder& r, GLuint name) {
+            if (!name || !r.programs.insert(name).second) return;
+
+            GLint separable = 0, length = 0;
+            glGetProgramiv(name, GL_PROGRAM_SEPARABLE, &separable);
+            glGetProgramiv(name, GL_PROGRAM_BINARY_LENGTH, &length);
+
+            std::vector<char> binary(static_cast<std::size_t>(std::max(length, 0)));
+            GLenum format = 0;
+            GLsizei written = 0;
+            if (length > 0) {
+                glGetProgramBinary(name, length, &written, &format, binary.data());
+            }
+            if (written <= 0) {
+                AUTOGL_LOG_WARN("Capture", "program " + std::to_string(name) +
+                                           " has no retrievable binary, replay skips it");
+                written = 0;
+            }
+
+            RecordScope rec(r, CaptureOp::DefineProgram);
+            r.out.u32(name);
+            r.out.u8(separable ? 1 : 0);
+            r.out.u32(format);
+            r.out.u32(static_cast<std::uint32_t>(written));
+            r.out.raw(binary.data(), static_cast<std::size_t>(written));
+
+            // uniform block binding은 바이너리에 없음 (링크 후 glUniformBlockBinding으로 바꾼 값)
+            GLint blocks = 0;
+            glGetProgramInterfaceiv(name, GL_UNIFORM_BLOCK, GL_ACTIVE_RESOURCES, &blocks);
+            r.out.u32(static_cast<std::uint32_t>(std::max(blocks, 0)));
+            for (GLint i = 0; i < blocks; ++i) {
+                const GLenum prop = GL_BUFFER_BINDING;
+                GLint binding = 0;
+                glGetProgramResourceiv(name, GL_UNIFORM_BLOCK, static_cast<GLuint>(i), 1, &prop, 1, nullptr, &binding);
+                r.out.u32(static_cast<std::uint32_t>(i));
+                r.out.u32(static_cast<std::uint32_t>(binding));
+            }
+
+            // 기본 블록 uniform 현재 값 (매 프레임 올리지 않는 값까지 재생에서 같게)
+            GLint uniforms = 0;
+            glGetProgramInterfaceiv(name, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniforms);
+            detail::ByteWriter values;
+            std::uint32_t valueCount = 0;
+            for (GLint i = 0; i < uniforms; ++i) {
+                const GLenum props[4] = { GL_BLOCK_INDEX, GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE };
+                GLint v[4] = { -1, -1, 0, 0 };
+                glGetProgramResourceiv(name, GL_UNIFORM, static_cast<GLuint>(i), 4, props, 4, nullptr, v);
+                const UniformLayout layout = uniformLayout(static_cast<GLenum>(v[2]));
+                if (v[0] != -1 || v[1] < 0 || layout.words == 0) continue;
+
+                values.i32(v[1]);
+                values.u32(static_cast<std::uint32_t>(v[2]));
+                values.u32(static_cast<std::uint32_t>(std::max(v[3], 1)));
+                for (GLint e = 0; e < std::max(v[3], 1); ++e) {
+                    GLuint words[16] = {};
+                    if (layout.base == 'f')      glGetUniformfv(name, v[1] + e, reinterpret_cast<GLfloat*>(words));
+                    else if (layout.base == 'i') glGetUniformiv(name, v[1] + e, reinterpret_cast<GLint*>(words));
+                    else                         glGetUniformuiv(name, v[1] + e, words);
+                    values.raw(words, sizeof(GLuint) * static_cast<std::size_t>(layout.words));
+                }
+                ++valueCount;
+            }
+            r.out.u32(valueCount);
+            r.out.raw(values.buf.data(), values.buf.size());
+        }
+
+        void ensurePipeline(Recorder& r, GLuint name) {
+            if (!name || !r.pipelines.insert(name).second) return;
+
+            constexpr std::pair<GLenum, GLbitfield> kStages[] = {
+                { GL_VERTEX_SHADER,          GL_VERTEX_SHADER_BIT },
+                { GL_TESS_CONTROL_SHADER,    GL_TESS_CONTROL_SHADER_BIT },
+                { GL_TESS_EVALUATION_SHADER, GL_TESS_EVALUATION_SHADER_BIT },
+                { GL_GEOMETRY_SHADER,        GL_GEOMETRY_SHADER_BIT },
+                { GL_FRAGMENT_SHADER,        GL_FRAGMENT_SHADER_BIT },
+                { GL_COMPUTE_SHADER,         GL_COMPUTE_SHADER_BIT },
+            };
+            std::vector<std::pair<GLbitfield, GLuint>> stages;
+            for (const auto& [stage, bit] : kStages) {
+                GLint program = 0;
+                glGetProgramPipelineiv(name, stage, &program);
+                if (program) {
+                    ensureProgram(r, static_cast<GLuint>(program));
+                    stages.emplace_back(bit, static_cast<GLuint>(program));
+                }
+            }
+
+            RecordScope rec(r, CaptureOp::DefinePipeline);
+            r.out.u32(name);
+            r.out.u32(static_cast<std::uint32_t>(stages.size()));
+            for (const auto& [bit, program] : stages) {
+                r.out.u32(bit);
+                r.out.u32(program);
+            }
+        }
+
+        void ensureVertexArray(Recorder& r, GLuint name) {
+            if (!name || !r.vertexArrays.insert(name).second) return;
+
+            GLint elementBuffer = 0, maxAttribs = 16;
+            glGetVertexArrayiv(name, GL_ELEMENT_ARRAY_BUFFER_BINDING, &elementBuffer);
+            glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxAttribs);
+            ensureBuffer(r, static_cast<GLuint>(elementBuffer));
+
+            struct Attrib {
+                GLint index, size, type, normalized, integer, relativeOffset, binding, buffer, stride, divisor;
+                GLint64 offset;
+            };
+            // binding 쪽 값(버퍼/오프셋/stride/divisor)은 VAO를 바인딩해야 읽을 수 있음.
+            // 기록되지 않도록 원래 함수로 잠깐 바인딩했다가 되돌림
+            GLint previous = 0;
+            glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previous);
+            Hook<glad_glBindVertexArray>::original(name);
+
+            std::vector<Attrib> attribs;
+            for (GLint i = 0; i < maxAttribs; ++i) {
+                const auto idx = static_cast<GLuint>(i);
+                GLint enabled = 0;
+                glGetVertexArrayIndexediv(name, idx, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+                if (!enabled) continue;
+
+                Attrib a{};
+                a.index = i;
+                glGetVertexArrayIndexediv(name, idx, GL_VERTEX_ATTRIB_ARRAY_SIZE, &a.size);
+                glGetVertexArrayIndexediv(name, idx, GL_VERTEX_ATTRIB_ARRAY_TYPE, &a.type);
+                glGetVertexArrayIndexediv(name, idx, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED, &a.normalized);
+                glGetVertexArrayIndexediv(name, idx, GL_VERTEX_ATTRIB_ARRAY_INTEGER, &a.integer);
+                glGetVertexArrayIndexediv(name, idx, GL_VERTEX_ATTRIB_RELATIVE_OFFSET, &a.relativeOffset);
+                glGetVertexArrayIndexediv(name, idx, GL_VERTEX_ATTRIB_BINDING, &a.binding);
+
+                const auto binding = static_cast<GLuint>(a.binding);
+                glGetIntegeri_v(GL_VERTEX_BINDING_BUFFER, binding, &a.buffer);
+                glGetIntegeri_v(GL_VERTEX_BINDING_STRIDE, binding, &a.stride);
+                glGetIntegeri_v(GL_VERTEX_BINDING_DIVISOR, binding, &a.divisor);
+                glGetInteger64i_v(GL_VERTEX_BINDING_OFFSET, binding, &a.offset);
+                attribs.push_back(a);
+            }
+            Hook<glad_glBindVertexArray>::original(static_cast<GLuint>(previous));
+
+            for (const Attrib& a : attribs) ensureBuffer(r, static_cast<GLuint>(a.buffer));
+
+            RecordScope rec(r, CaptureOp::DefineVertexArray);
+            r.out.u32(name);
+            r.out.u32(static_cast<std::uint32_t>(elementBuffer));
+            r.out.u32(static_cast<std::uint32_t>(attribs.size()));
+            for (const Attrib& a : attribs) {
+                for (GLint v : { a.index, a.size, a.type, a.normalized, a.integer, a.relativeOffset,
+                                 a.binding, a.buffer, a.stride, a.divisor }) {
+                    r.out.i32(v);
+                }
+                r.out.u64(static_cast<std::uint64_t>(a.offset));
+            }
+        }
+
+        void ensureFramebuffer(Recorder& r, GLuint name) {
+            if (!name || !r.framebuffers.insert(name).second) return;
+
+            std::vector<GLenum> attachments = { GL_DEPTH_ATTACHMENT, GL_STENCIL_ATTACHMENT };
+            for (GLenum i = 0; i < 8; ++i) attachments.push_back(GL_COLOR_ATTACHMENT0 + i);
+
+            std::vector<std::array<GLint, 3>> textures;
+            for (GLenum attachment : attachments) {
+                GLint type = GL_NONE;
+                glGetNamedFramebufferAttachmentParameteriv(name, attachment,
+                                                           GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &type);
+                if (type != GL_TEXTURE) continue;
+
+                GLint texture = 0, level = 0;
+                glGetNamedFramebufferAttachmentParameteriv(name, attachment,
+                                                           GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &texture);
+                glGetNamedFramebufferAttachmentParameteriv(name, attachment,
+                                                           GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LEVEL, &level);
+                ensureTexture(r, static_cast<GLuint>(texture));
+                textures.push_back({ static_cast<GLint>(attachment), texture, level });
+            }
+
+            RecordScope rec(r, CaptureOp::DefineFramebuffer);
+            r.out.u32(name);
+            r.out.u32(static_cast<std::uint32_t>(textures.size()));
+            for (const auto& t : textures) {
+                r.out.u32(static_cast<std::uint32_t>(t[0]));
+                r.out.u32(static_cast<std::uint32_t>(t[1]));
+                r.out.i32(t[2]);
+            }
+        }
+
+        // ---------------- 래퍼: 기록 후 원래 함수 호출 ----------------
+
+        void APIENTRY hookEnable(GLenum cap) {
+            if (Recorder* r = recording()) {
+                RecordScope rec(*r, CaptureOp::Enable);
+                r->out.u32(cap);
+            }
+            Hook<glad_glEnable>::original(cap);
+        }
+
+        void APIENTRY hookDisable(GLenum cap) {
+            if (Recorder* r = recording()) {
+                RecordScope rec(*r, CaptureOp::Disable);
+                r->out.u32(cap);
+            }
+            Hook<glad_glDisable>::original(cap);
+        }
+
+        void APIENTRY hookBlendFunc(GLenum src, GLenum dst) {
+            if (Recorder* r = recording()) {
+                RecordScope rec(*r, CaptureOp::BlendFunc);
+                r->out.u32(src);
+                r->out.u32(dst);
+            }
+            Hook<glad_glBlendFunc>::original(src, dst);
+        }
+
+        void APIENTRY hookColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+            if (Recorder* r = recording()) {
+                RecordScope rec(*r, CaptureOp::ColorMask);
+                for (GLboolean b : { red, green, blue, alpha }) r->out.u8(b);
+            }
+            Hook<glad_glColorMask>::original(red, green, blue, alpha);
+        }
+
+        void APIENTRY hookClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+            if (Recorder* r = recording()) {
+                RecordScope rec(*r, CaptureOp::ClearColor);
+                for (GLfloat f : { red, green, blue, alpha }) r->out.f32(f);
+            }
+            Hook<glad_glClearColor>::original(red, green, blue, alpha);
+        }
+
+        void APIENTRY hookClear(GLbitfield mask) {
+            if (Recorder* r = recording()) {
+                RecordScope rec(*r, CaptureOp::Clear);
+                r->out.u32(mask);
+            }
+            Hook<glad_glClear>::original(mask);
+        }
+
+        void APIENTRY hookViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+            if (Recorder* r = recording()) {
+                RecordScope rec(*r, CaptureOp::Viewport);
+                for (GLint v : { x, y, width, height }) r->out.i32(v);
+            }
+            Hook<glad_glViewport>::original(x, y, width, height);
+        }
+
+        void APIENTRY hookMemoryBarrier(GLbitfield barriers) {
+            if (Recorder* r = recording()) {
+                RecordScope rec(*r, CaptureOp::MemoryBarrier);
+                r->out.u32(barriers);
+            }
+            Hook<glad_glMemoryBarrier>::original(barriers);
+        }
+
+        void APIENTRY hookUseProgram(GLuint program) {
+            if (Recorder* r = recording()) {
+                ensureProgram(*r, program);
+                RecordScope rec(*r, CaptureOp::UseProgram);
+                r->out.u32(program);
+            }
+            Hook<glad_glUseProgram>::original(program);
+        }
+
+        void APIENTRY hookBindProgramPipeline(GLuint pipeline) {
+            if (Recorder* r = recording()) {
+                ensurePipeline(*r, pipeline);
+                RecordScope rec(*r, CaptureOp::BindProgramPipeline);
+                r->out.u32(pipeline);
+            }
+            Hook<glad_glBindProgramPipeline>::original(pipeline);
+        }
+
+        void APIENTRY hookUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+            if (Recorder* r = recording()) {
+                ensurePipeline(*r, pipeline);
+                ensureProgram(*r, program);
+                RecordScope rec(*r, CaptureOp::UseProgramStages);
+                r->out.u32(pipeline);
+                r->out.u32(stages);
+                r->out.u32(program);
+            }
+            Hook<glad_glUseProgramStages>::original(pipeline, stages, program);
+        }
+
+        void APIENTRY hookBindVertexArray(GLuint vao) {
+            if (Recorder* r = recording()) {
+                ensureVertexArray(*r, vao);
+                RecordScope rec(*r, CaptureOp::BindVertexArray);
+                r->out.u32(vao);
+            }
+            Hook<glad_glBindVertexArray>::original(vao);
+        }
+
+        void APIENTRY hookBindBuffer(GLenum target, GLuint buffer) {
+            if (Recorder* r = recording()) {
+                ensureBuffer(*r, buffer);
+                RecordScope rec(*r, CaptureOp::BindBuffer);
+                r->out.u32(target);
+                r->out.u32(buffer);
+            }
+            Hook<glad_glBindBuffer>::original(target, buffer);
+        }
+
+        void recordBindRange(Recorder& r, GLenum target, GLuint index, GLuint buffer,
+                             GLintptr offset, GLsizeiptr size) {
+            ensureBuffer(r, buffer);
+            RecordScope rec(r, CaptureOp::BindBufferRange);
+            r.out.u32(target);
+            r.out.u32(index);
+            r.out.u32(buffer);
+            r.out.u64(static_cast<std::uint64_t>(offset));
+            r.out.u64(static_cast<std::uint64_t>(size));
+        }
+
+        void APIENTRY hookBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+            if (Recorder* r = recording()) recordBindRange(*r, target, index, buffer, 0, 0);
+            Hook<glad_glBindBufferBase>::original(target, index, buffer);
+        }
+
+        void APIENTRY hookBindBufferRange(GLenum target, GLuint index, GLuint buffer,
+                                          GLintptr offset, GLsizeiptr size) {
+            if (Recorder* r = recording()) recordBindRange(*r, target, index, buffer, offset, size);
+            Hook<glad_glBindBufferRange>::original(target, index, buffer, offset, size);
+        }
+
+        void APIENTRY hookBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered,
+                                           GLint layer, GLenum access, GLenum format) {
+            if (Recorder* r = recording()) {
+                ensureTexture(*r, texture);
+                RecordScope rec(*r, CaptureOp::BindImageTexture);
+                r->out.u32(unit);
+                r->out.u32(texture);
+                r->out.i32(level);
+                r->out.u8(layered);
+                r->out.i32(layer);
+                r->out.u32(access);
+                r->out.u32(format);
+            }
+            Hook<glad_glBindImageTexture>::original(unit, texture, level, layered, layer, access, format);
+        }
+
+        void APIENTRY hookBindFramebuffer(GLenum target, GLuint framebuffer) {
+            if (Recorder* r = recording()) {
+                ensureFramebuffer(*r, framebuffer);
+                RecordScope rec(*r, CaptureOp::BindFramebuffer);
+                r->out.u32(target);
+                r->out.u32(framebuffer);
+            }
+            Hook<glad_glBindFramebuffer>::original(target, framebuffer);
+        }
+
+        void recordDrawArrays(Recorder& r, GLenum mode, GLint first, GLsizei count, GLsizei instances) {
+            syncMappedWrites(r);
+            RecordScope rec(r, CaptureOp::DrawArrays);
+            r.out.u32(mode);
+            r.out.i32(first);
+            r.out.i32(count);
+            r.out.i32(instances);
+        }
+
+        void APIENTRY hookDrawArrays(GLenum mode, GLint first, GLsizei count) {
+            if (Recorder* r = recording()) recordDrawArrays(*r, mode, first, count, 1);
+            Hook<glad_glDrawArrays>::original(mode, first, count);
+        }
+
+        void APIENTRY hookDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances) {
+            if (Recorder* r = recording()) recordDrawArrays(*r, mode, first, count, instances);
+            Hook<glad_glDrawArraysInstanced>::original(mode, first, count, instances);
+        }
+
+        // indices는 바인딩된 element 버퍼 안의 오프셋으로 기록 (클라이언트 메모리 인덱스는 쓰지 않음)
+        void recordDrawElements(Recorder& r, GLenum mode, GLsizei count, GLenum type,
+                                const void* indices, GLsizei instances) {
+            syncMappedWrites(r);
+            RecordScope rec(r, CaptureOp::DrawElements);
+            r.out.u32(mode);
+            r.out.i32(count);
+            r.out.u32(type);
+            r.out.u64(reinterpret_cast<std::uintptr_t>(indices));
+            r.out.i32(instances);
+        }
+
+        void APIENTRY hookDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) {
+            if (Recorder* r = recording()) recordDrawElements(*r, mode, count, type, indices, 1);
+            Hook<glad_glDrawElements>::original(mode, count, type, indices);
+        }
+
+        void APIENTRY hookDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
+                                                const void* indices, GLsizei instances) {
+            if (Recorder* r = recording()) recordDrawElements(*r, mode, count, type, indices, instances);
+            Hook<glad_glDrawElementsInstanced>::original(mode, count, type, indices, instances);
+        }
+
+        void APIENTRY hookMultiDrawArraysIndirect(GLenum mode, const void* indirect, GLsizei drawCount,
+                                                  GLsizei stride) {
+            if (Recorder* r = recording()) {
+                syncMappedWrites(*r);
+                RecordScope rec(*r, CaptureOp::MultiDrawArraysIndirect);
+                r->out.u32(mode);
+                r->out.u64(reinterpret_cast<std::uintptr_t>(indirect));
+                r->out.i32(drawCount);
+                r->out.i32(stride);
+            }
+            Hook<glad_glMultiDrawArraysIndirect>::original(mode, indirect, drawCount, stride);
+        }
+
+        void APIENTRY hookMultiDrawElementsIndirect(GLenum mode, GLenum type, const void* indirect,
+                                                    GLsizei drawCount, GLsizei stride) {
+            if (Recorder* r = recording()) {
+                syncMappedWrites(*r);
+                RecordScope rec(*r, CaptureOp::MultiDrawElementsIndirect);
+                r->out.u32(mode);
+                r->out.u32(type);
+                r->out.u64(reinterpret_cast<std::uintptr_t>(indirect));
+                r->out.i32(drawCount);
+                r->out.i32(stride);
+            }
+            Hook<glad_glMultiDrawElementsIndirect>::original(mode, type, indirect, drawCount, stride);
+        }
+
+        void APIENTRY hookMultiDrawArraysIndirectCount(GLenum mode, const void* indirect, GLintptr drawCount,
+                                                       GLsizei maxDrawCount, GLsizei stride) {
+            if (Recorder* r = recording()) {
+                syncMappedWrites(*r);
+                RecordScope rec(*r, CaptureOp::MultiDrawArraysIndirectCount);
+                r->out.u32(mode);
+                r->out.u64(reinterpret_cast<std::uintptr_t>(indirect));
+                r->out.u64(static_cast<std::uint64_t>(drawCount));
+                r->out.i32(maxDrawCount);
+                r->out.i32(stride);
+            }
+            Hook<glad_glMultiDrawArraysIndirectCount>::original(mode, indirect, drawCount, maxDrawCount, stride);
+        }
+
+        void APIENTRY hookMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void* indirect,
+                                                         GLintptr drawCount, GLsizei maxDrawCount, GLsizei stride) {
+            if (Recorder* r = recording()) {
+                syncMappedWrites(*r);
+                RecordScope rec(*r, CaptureOp::MultiDrawElementsIndirectCount);
+                r->out.u32(mode);
+                r->out.u32(type);
+                r->out.u64(reinterpret_cast<std::uintptr_t>(indirect));
+                r->out.u64(static_cast<std::uint64_t>(drawCount));
+                r->out.i32(maxDrawCount);
+                r->out.i32(stride);
+            }
+            Hook<glad_glMultiDrawElementsIndirectCount>::original(mode, type, indirect, drawCount,
+                                                                  maxDrawCount, stride);
+        }
+
+        void APIENTRY hookDispatchCompute(GLuint x, GLuint y, GLuint z) {
+            if (Recorder* r = recording()) {
+                syncMappedWrites(*r);
+                RecordScope rec(*r, CaptureOp::DispatchCompute);
+                for (GLuint v : { x, y, z }) r->out.u32(v);
+            }
+            Hook<glad_glDispatchCompute>::original(x, y, z);
+        }
+
+        void recordUniform(Recorder& r, GLuint program, GLint location, char base, int n,
+                           GLsizei count, const void* value) {
+            if (location < 0 || count <= 0) return;
+            ensureProgram(r, program);
+            RecordScope rec(r, CaptureOp::ProgramUniform);
+            r.out.u32(program);
+            r.out.i32(location);
+            r.out.u8(static_cast<std::uint8_t>(base));
+            r.out.u8(static_cast<std::uint8_t>(n));
+            r.out.i32(count);
+            r.out.raw(value, sizeof(GLuint) * static_cast<std::size_t>(n) * static_cast<std::size_t>(count));
+        }
+
+        template <auto& Ptr, char Base, int N, typename T>
+        void APIENTRY hookUniformv(GLuint program, GLint location, GLsizei count, const T* value) {
+            if (Recorder* r = recording()) recordUniform(*r, program, location, Base, N, count, value);
+            Hook<Ptr>::original(program, location, count, value);
+        }
+
+        template <auto& Ptr, char Base, typename T>
+        void APIENTRY hookUniform1(GLuint program, GLint location, T value) {
+            if (Recorder* r = recording()) recordUniform(*r, program, location, Base, 1, 1, &value);
+            Hook<Ptr>::original(program, location, value);
+        }
+
+        void APIENTRY hookNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data) {
+            if (Recorder* r = recording(); r && data) {
+                ensureBuffer(*r, buffer);
+                RecordScope rec(*r, CaptureOp::NamedBufferSubData);
+                r->out.u32(buffer);
+                r->out.u64(static_cast<std::uint64_t>(offset));
+                r->out.u64(static_cast<std::uint64_t>(size));
+                r->out.raw(data, static_cast<std::size_t>(size));
+            }
+            Hook<glad_glNamedBufferSubData>::original(buffer, offset, size, data);
+        }
+
+        // size 0 = 버퍼 전체 (glClearNamedBufferData)
+        void recordClearBuffer(Recorder& r, GLuint buffer, GLenum internalFormat, GLintptr offset,
+                               GLsizeiptr size, GLenum format, GLenum type, const void* data) {
+            ensureBuffer(r, buffer);
+            RecordScope rec(r, CaptureOp::ClearNamedBufferSubData);
+            r.out.u32(buffer);
+            r.out.u32(internalFormat);
+            r.out.u64(static_cast<std::uint64_t>(offset));
+            r.out.u64(static_cast<std::uint64_t>(size));
+            r.out.u32(format);
+            r.out.u32(type);
+            const std::size_t bytes = data ? clientPixelBytes(format, type) : 0;
+            r.out.u32(static_cast<std::uint32_t>(bytes));
+            r.out.raw(data, bytes);
+        }
+
+        void APIENTRY hookClearNamedBufferData(GLuint buffer, GLenum internalFormat, GLenum format,
+                                               GLenum type, const void* data) {
+            if (Recorder* r = recording()) recordClearBuffer(*r, buffer, internalFormat, 0, 0, format, type, data);
+            Hook<glad_glClearNamedBufferData>::original(buffer, internalFormat, format, type, data);
+        }
+
+        void APIENTRY hookClearNamedBufferSubData(GLuint buffer, GLenum internalFormat, GLintptr offset,
+                                                  GLsizeiptr size, GLenum format, GLenum type, const void* data) {
+            if (Recorder* r = recording(); r && size > 0) {
+                recordClearBuffer(*r, buffer, internalFormat, offset, size, format, type, data);
+            }
+            Hook<glad_glClearNamedBufferSubData>::original(buffer, internalFormat, offset, size, format, type, data);
+        }
+
+        void APIENTRY hookCopyNamedBufferSubData(GLuint read, GLuint write, GLintptr readOffset,
+                                                 GLintptr writeOffset, GLsizeiptr size) {
+            if (Recorder* r = recording()) {
+                ensureBuffer(*r, read);
+                ensureBuffer(*r, write);
+                RecordScope rec(*r, CaptureOp::CopyNamedBufferSubData);
+                r->out.u32(read);
+                r->out.u32(write);
+                r->out.u64(static_cast<std::uint64_t>(readOffset));
+                r->out.u64(static_cast<std::uint64_t>(writeOffset));
+                r->out.u64(static_cast<std::uint64_t>(size));
+            }
+            Hook<glad_glCopyNamedBufferSubData>::original(read, write, readOffset, writeOffset, size);
+        }
+
+        void APIENTRY hookClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void* data) {
+            if (Recorder* r = recording()) {
+                ensureTexture(*r, texture);
+                RecordScope rec(*r, CaptureOp::ClearTexImage);
+                r->out.u32(texture);
+                r->out.i32(level);
+                r->out.u32(format);
+                r->out.u32(type);
+                const std::size_t bytes = data ? clientPixelBytes(format, type) : 0;
+                r->out.u32(static_cast<std::uint32_t>(bytes));
+                r->out.raw(data, bytes);
+            }
+            Hook<glad_glClearTexImage>::original(texture, level, format, type, data);
+        }
+
+        void APIENTRY hookClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawBuffer,
+                                                  const GLfloat* value) {
+            if (Recorder* r = recording()) {
+                ensureFramebuffer(*r, framebuffer);
+                RecordScope rec(*r, CaptureOp::ClearNamedFramebufferfv);
+                r->out.u32(framebuffer);
+                r->out.u32(buffer);
+                r->out.i32(drawBuffer);
+                const int n = buffer == GL_COLOR ? 4 : 1;
+                for (int i = 0; i < 4; ++i) r->out.f32(i < n ? value[i] : 0.0f);
+            }
+            Hook<glad_glClearNamedFramebufferfv>::original(framebuffer, buffer, drawBuffer, value);
+        }
+
+        void APIENTRY hookBlitNamedFramebuffer(GLuint read, GLuint draw,
+                                               GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1,
+                                               GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1,
+                                               GLbitfield mask, GLenum filter) {
+            if (Recorder* r = recording()) {
+                ensureFramebuffer(*r, read);
+                ensureFramebuffer(*r, draw);
+                RecordScope rec(*r, CaptureOp::BlitNamedFramebuffer);
+                r->out.u32(read);
+                r->out.u32(draw);
+                for (GLint v : { srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1 }) r->out.i32(v);
+                r->out.u32(mask);
+                r->out.u32(filter);
+            }
+            Hook<glad_glBlitNamedFramebuffer>::original(read, draw, srcX0, srcY0, srcX1, srcY1,
+                                                        dstX0, dstY0, dstX1, dstY1, mask, filter);
+        }
+
+        void APIENTRY hookCopyImageSubData(GLuint src, GLenum srcTarget, GLint srcLevel,
+                                           GLint srcX, GLint srcY, GLint srcZ,
+                                           GLuint dst, GLenum dstTarget, GLint dstLevel,
+                                           GLint dstX, GLint dstY, GLint dstZ,
+                                           GLsizei width, GLsizei height, GLsizei depth) {
+            if (Recorder* r = recording(); r && srcTarget != GL_RENDERBUFFER && dstTarget != GL_RENDERBUFFER) {
+                ensureTexture(*r, src);
+                ensureTexture(*r, dst);
+                RecordScope rec(*r, CaptureOp::CopyImageSubData);
+                r->out.u32(src);
+                r->out.u32(srcTarget);
+                for (GLint v : { srcLevel, srcX, srcY, srcZ }) r->out.i32(v);
+                r->out.u32(dst);
+                r->out.u32(dstTarget);
+                for (GLint v : { dstLevel, dstX, dstY, dstZ, width, height, depth }) r->out.i32(v);
+            }
+            Hook<glad_glCopyImageSubData>::original(src, srcTarget, srcLevel, srcX, srcY, srcZ,
+                                                    dst, dstTarget, dstLevel, dstX, dstY, dstZ,
+                                                    width, height, depth);
+        }
+
+        void APIENTRY hookNamedFramebufferTexture(GLuint framebuffer, GLenum attachment,
+                                                  GLuint texture, GLint level) {
+            if (Recorder* r = recording()) {
+                ensureFramebuffer(*r, framebuffer);
+                ensureTexture(*r, texture);
+                RecordScope rec(*r, CaptureOp::NamedFramebufferTexture);
+                r->out.u32(framebuffer);
+                r->out.u32(attachment);
+                r->out.u32(texture);
+                r->out.i32(level);
+            }
+            Hook<glad_glNamedFramebufferTexture>::original(framebuffer, attachment, texture, level);
+        }
+
+        void installHooks() {
+            // ARB_indirect_parameters 진입점을 glad 포인터에 채운 뒤에 바꿔 끼움
+            QueryExtensions();
+
+            install<glad_glEnable>(&hookEnable);
+            install<glad_glDisable>(&hookDisable);
+            install<glad_glBlendFunc>(&hookBlendFunc);
+            install<glad_glColorMask>(&hookColorMask);
+            install<glad_glClearColor>(&hookClearColor);
+            install<glad_glClear>(&hookClear);
+            install<glad_glViewport>(&hookViewport);
+            install<glad_glMemoryBarrier>(&hookMemoryBarrier);
+
+            install<glad_glUseProgram>(&hookUseProgram);
+            install<glad_glBindProgramPipeline>(&hookBindProgramPipeline);
+            install<glad_glUseProgramStages>(&hookUseProgramStages);
+            install<glad_glBindVertexArray>(&hookBindVertexArray);
+            install<glad_glBindBuffer>(&hookBindBuffer);
+            install<glad_glBindBufferBase>(&hookBindBufferBase);
+            install<glad_glBindBufferRange>(&hookBindBufferRange);
+            install<glad_glBindImageTexture>(&hookBindImageTexture);
+            install<glad_glBindFramebuffer>(&hookBindFramebuffer);
+
+            install<glad_glDrawArrays>(&hookDrawArrays);
+            install<glad_glDrawArraysInstanced>(&hookDrawArraysInstanced);
+            install<glad_glDrawElements>(&hookDrawElements);
+            install<glad_glDrawElementsInstanced>(&hookDrawElementsInstanced);
+            install<glad_glMultiDrawArraysIndirect>(&hookMultiDrawArraysIndirect);
+            install<glad_glMultiDrawElementsIndirect>(&hookMultiDrawElementsIndirect);
+            install<glad_glMultiDrawArraysIndirectCount>(&hookMultiDrawArraysIndirectCount);
+            install<glad_glMultiDrawElementsIndirectCount>(&hookMultiDrawElementsIndirectCount);
+            install<glad_glDispatchCompute>(&hookDispatchCompute);
+
+            install<glad_glProgramUniform1f>(&hookUniform1<glad_glProgramUniform1f, 'f', GLfloat>);
+            install<glad_glProgramUniform1i>(&hookUniform1<glad_glProgramUniform1i, 'i', GLint>);
+            install<glad_glProgramUniform1ui>(&hookUniform1<glad_glProgramUniform1ui, 'u', GLuint>);
+            install<glad_glProgramUniform1fv>(&hookUniformv<glad_glProgramUniform1fv, 'f', 1, GLfloat>);
+            install<glad_glProgramUniform2fv>(&hookUniformv<glad_glProgramUniform2fv, 'f', 2, GLfloat>);
+            install<glad_glProgramUniform3fv>(&hookUniformv<glad_glProgramUniform3fv, 'f', 3, GLfloat>);
+            install<glad_glProgramUniform4fv>(&hookUniformv<glad_glProgramUniform4fv, 'f', 4, GLfloat>);
+            install<glad_glProgramUniform1iv>(&hookUniformv<glad_glProgramUniform1iv, 'i', 1, GLint>);
+            install<glad_glProgramUniform2iv>(&hookUniformv<glad_glProgramUniform2iv, 'i', 2, GLint>);
+            install<glad_glProgramUniform3iv>(&hookUniformv<glad_glProgramUniform3iv, 'i', 3, GLint>);
+            install<glad_glProgramUniform4iv>(&hookUniformv<glad_glProgramUniform4iv, 'i', 4, GLint>);
+            install<glad_glProgramUniform1uiv>(&hookUniformv<glad_glProgramUniform1uiv, 'u', 1, GLuint>);
+            install<glad_glProgramUniform2uiv>(&hookUniformv<glad_glProgramUniform2uiv, 'u', 2, GLuint>);
+            install<glad_glProgramUniform3uiv>(&hookUniformv<glad_glProgramUniform3uiv, 'u', 3, GLuint>);
+            install<glad_glProgramUniform4uiv>(&hookUniformv<glad_glProgramUniform4uiv, 'u', 4, GLuint>);
+
+            install<glad_glNamedBufferSubData>(&hookNamedBufferSubData);
+            install<glad_glClearNamedBufferData>(&hookClearNamedBufferData);
+            install<glad_glClearNamedBufferSubData>(&hookClearNamedBufferSubData);
+            install<glad_glCopyNamedBufferSubData>(&hookCopyNamedBufferSubData);
+            install<glad_glClearTexImage>(&hookClearTexImage);
+            install<glad_glClearNamedFramebufferfv>(&hookClearNamedFramebufferfv);
+            install<glad_glBlitNamedFramebuffer>(&hookBlitNamedFramebuffer);
+            install<glad_glCopyImageSubData>(&hookCopyImageSubData);
+            install<glad_glNamedFramebufferTexture>(&hookNamedFramebufferTexture);
+        }
+
+        // 캡처 시작 시점의 상태를 같은 값으로 다시 호출해서 기록 (래퍼를 거치므로 Define도 같이 남음)
+        void recordInitialState() {
+            for (GLenum cap : { GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST,
+                                GL_FRAMEBUFFER_SRGB, GL_PROGRAM_POINT_SIZE }) {
+                if (glIsEnabled(cap)) glEnable(cap);
+                else                  glDisable(cap);
+            }
+
+            GLint blend[2] = { GL_ONE, GL_ZERO };
+            glGetIntegerv(GL_BLEND_SRC_RGB, &blend[0]);
+            glGetIntegerv(GL_BLEND_DST_RGB, &blend[1]);
+            glBlendFunc(static_cast<GLenum>(blend[0]), static_cast<GLenum>(blend[1]));
+
+            GLboolean mask[4] = { GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE };
+            glGetBooleanv(GL_COLOR_WRITEMASK, mask);
+            glColorMask(mask[0], mask[1], mask[2], mask[3]);
+
+            GLfloat clear[4] = {};
+            glGetFloatv(GL_COLOR_CLEAR_VALUE, clear);
+            glClearColor(clear[0], clear[1], clear[2], clear[3]);
+
+            GLint viewport[4] = {};
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+            GLint name = 0;
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &name);
+            glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(name));
+            glGetIntegerv(GL_PROGRAM_PIPELINE_BINDING, &name);
+            glBindProgramPipeline(static_cast<GLuint>(name));
+            glGetIntegerv(GL_CURRENT_PROGRAM, &name);
+            glUseProgram(static_cast<GLuint>(name));
+            glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &name);
+            glBindVertexArray(static_cast<GLuint>(name));
+            glGetIntegerv(GL_DRAW_INDIRECT_BUFFER_BINDING, &name);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, static_cast<GLuint>(name));
+            if (QueryExtensions().indirectCount) {
+                glGetIntegerv(GL_PARAMETER_BUFFER_BINDING, &name);
+                glBindBuffer(GL_PARAMETER_BUFFER, static_cast<GLuint>(name));
+            }
+
+            // SSBO/UBO 바인딩 (프레임마다 다시 바인딩하지 않는 compute 상태 버퍼 등)
+            constexpr GLuint kIndexedBindings = 16;
+            const std::pair<GLenum, std::array<GLenum, 3>> kTargets[] = {
+                { GL_SHADER_STORAGE_BUFFER, { GL_SHADER_STORAGE_BUFFER_BINDING,
+                                              GL_SHADER_STORAGE_BUFFER_START, GL_SHADER_STORAGE_BUFFER_SIZE } },
+                { GL_UNIFORM_BUFFER,        { GL_UNIFORM_BUFFER_BINDING,
+                                              GL_UNIFORM_BUFFER_START, GL_UNIFORM_BUFFER_SIZE } },
+            };
+            for (const auto& [target, queries] : kTargets) {
+                for (GLuint i = 0; i < kIndexedBindings; ++i) {
+                    GLint buffer = 0;
+                    GLint64 start = 0, size = 0;
+                    glGetIntegeri_v(queries[0], i, &buffer);
+                    if (!buffer) continue;
+                    glGetInteger64i_v(queries[1], i, &start);
+                    glGetInteger64i_v(queries[2], i, &size);
+                    if (size > 0) glBindBufferRange(target, i, static_cast<GLuint>(buffer), start, size);
+                    else          glBindBufferBase(target, i, static_cast<GLuint>(buffer));
+                }
+            }
+        }
+    }
+
+    // ---------------- CommandCapture ----------------
+
+    CommandCapture::~CommandCapture() {
+        finish();
+    }
+
+    bool CommandCapture::begin(const std::string& path, int frames, int width, int height) {
+        if (active_) return false;
+        if (g_recorder.load(std::memory_order_acquire)) {
+            AUTOGL_LOG_ERROR("Capture", "another capture is already running");
+            return false;
+        }
+
+        installHooks();
+
+        g_owned = std::make_unique<Recorder>();
+        g_owned->thread = std::this_thread::get_id();
+        g_owned->out.raw(kCaptureMagic, sizeof(kCaptureMagic));
+        g_owned->out.u32(kCaptureVersion);
+        g_owned->out.i32(width);
+        g_owned->out.i32(height);
+        g_recorder.store(g_owned.get(), std::memory_order_release);
+
+        path_     = path;
+        frames_   = std::max(frames, 1);
+        recorded_ = 0;
+        active_   = true;
+
+        recordInitialState();
+        AUTOGL_LOG_INFO("Capture", "capturing " + std::to_string(frames_) + " frame(s) to " + path_);
+        return true;
+    }
+
+    bool CommandCapture::endFrame() {
+        if (!active_) return false;
+
+        {
+            RecordScope rec(*g_owned, CaptureOp::FrameEnd);
+        }
+        if (++recorded_ < frames_) return false;
+
+        finish();
+        return true;
+    }
+
+    void CommandCapture::finish() {
+        if (!active_) return;
+        active_ = false;
+        g_recorder.store(nullptr, std::memory_order_release);
+        std::unique_ptr<Recorder> r = std::move(g_owned);
+
+        if (recorded_ < frames_) {
+            AUTOGL_LOG_WARN("Capture", "stopped after " + std::to_string(recorded_) + " of " +
+                                       std::to_string(frames_) + " frame(s)");
+        }
+
+        std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(r->out.buf.data(), static_cast<std::streamsize>(r->out.buf.size()))) {
+            AUTOGL_LOG_ERROR("Capture", "cannot write " + path_);
+            return;
+        }
+        AUTOGL_LOG_INFO("Capture", "captured " + std::to_string(recorded_) + " frame(s), " +
+                                   std::to_string(r->records) + " records, " +
+                                   std::to_string(r->out.buf.size() / 1024) + " KiB -> " + path_);
+    }
+
+    // ---------------- CommandReplay ----------------
+
+    namespace {
+        GLuint lookup(const std::unordered_map<GLuint, GLuint>& names, GLuint name) {
+            if (!name) return 0;
+            auto it = names.find(name);
+            return it == names.end() ? 0 : it->second;
+        }
+
+        bool isDefine(CaptureOp op) {
+            const auto v = static_cast<std::uint8_t>(op);
+            return v >= static_cast<std::uint8_t>(CaptureOp::DefineBuffer) &&
+                   v <= static_cast<std::uint8_t>(CaptureOp::DefineFramebuffer);
+        }
+    }
+
+    bool CommandReplay::load(const std::string& path) {
+        release();
+        defines_.clear();
+        frames_.clear();
+        if (!file_.open(path)) return false;
+
+        detail::ByteReader r(file_.data(), file_.size());
+        const char* magic = r.take(sizeof(kCaptureMagic));
+        const std::uint32_t version = r.u32();
+        width_  = r.i32();
+        height_ = r.i32();
+        if (!magic || std::memcmp(magic, kCaptureMagic, sizeof(kCaptureMagic)) != 0 ||
+            version != kCaptureVersion || width_ <= 0 || height_ <= 0) {
+            AUTOGL_LOG_ERROR("Replay", "not a capture file (or unsupported version): " + path);
+            return false;
+        }
+
+        std::vector<Record> frame;
+        while (!r.atEnd()) {
+            const auto op = static_cast<CaptureOp>(r.u8());
+            const std::uint32_t size = r.u32();
+            const char* data = r.take(size);
+            if (!r.ok()) {
+                AUTOGL_LOG_ERROR("Replay", "truncated capture file: " + path);
+                return false;
+            }
+
+            if (op == CaptureOp::FrameEnd) {
+                frames_.push_back(std::move(frame));
+                frame.clear();
+            } else if (isDefine(op)) {
+                defines_.push_back({ op, data, size });
+            } else {
+                frame.push_back({ op, data, size });
+            }
+        }
+        if (!frame.empty()) frames_.push_back(std::move(frame));
+
+        if (frames_.empty()) {
+            AUTOGL_LOG_ERROR("Replay", "capture has no frames: " + path);
+            return false;
+        }
+        return true;
+    }
+
+    bool CommandReplay::prepare() {
+        bool ok = true;
+        for (const Record& rec : defines_) {
+            ok = define(rec) && ok;
+        }
+        return ok;
+    }
+
+    void CommandReplay::playFrame(std::size_t index) {
+        if (index >= frames_.size()) return;
+        for (const Record& rec : frames_[index]) {
+            execute(rec);
+        }
+    }
+
+    bool CommandReplay::define(const Record& rec) {
+        detail::ByteReader r(rec.data, rec.size);
+        const GLuint name = r.u32();
+
+        switch (rec.op) {
+        case CaptureOp::DefineBuffer: {
+            const std::uint64_t size = r.u64();
+            const char* data = r.take(static_cast<std::size_t>(size));
+            GLuint buffer = 0;
+            glCreateBuffers(1, &buffer);
+            if (size > 0) {
+                glNamedBufferStorage(buffer, static_cast<GLsizeiptr>(size), data, GL_DYNAMIC_STORAGE_BIT);
+            }
+            buffers_[name] = buffer;
+            break;
+        }
+        case CaptureOp::DefineTexture: {
+            const auto target = static_cast<GLenum>(r.u32());
+            const auto levels = static_cast<GLsizei>(r.u32());
+            const auto internalFormat = static_cast<GLenum>(r.u32());
+            const GLsizei w = r.i32(), h = r.i32(), d = r.i32();
+
+            GLuint texture = 0;
+            glCreateTextures(target, 1, &texture);
+            const bool layered3D = target == GL_TEXTURE_3D || target == GL_TEXTURE_2D_ARRAY ||
+                                   target == GL_TEXTURE_CUBE_MAP_ARRAY;
+            if (target == GL_TEXTURE_1D)  glTextureStorage1D(texture, levels, internalFormat, w);
+            else if (layered3D)           glTextureStorage3D(texture, levels, internalFormat, w, h, d);
+            else                          glTextureStorage2D(texture, levels, internalFormat, w, h);
+
+            GLenum format = 0, type = 0;
+            const bool known = transferFormat(internalFormat, format, type);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            for (GLsizei level = 0; level < levels && r.ok(); ++level) {
+                const std::uint32_t bytes = r.u32();
+                const char* pixels = r.take(bytes);
+                if (!known || bytes == 0 || !pixels) continue;
+
+                const GLsizei lw = std::max(w >> level, 1);
+                const GLsizei lh = target == GL_TEXTURE_1D_ARRAY ? h : std::max(h >> level, 1);
+                const GLsizei ld = target == GL_TEXTURE_3D ? std::max(d >> level, 1) : d;
+                if (target == GL_TEXTURE_1D) {
+                    glTextureSubImage1D(texture, level, 0, lw, format, type, pixels);
+                } else if (layered3D || target == GL_TEXTURE_CUBE_MAP) {
+                    glTextureSubImage3D(texture, level, 0, 0, 0, lw, lh, ld, format, type, pixels);
+                } else {
+                    glTextureSubImage2D(texture, level, 0, 0, lw, lh, format, type, pixels);
+                }
+            }
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            textures_[name] = texture;
+            break;
+        }
+        case CaptureOp::DefineProgram: {
+            const bool separable = r.u8() != 0;
+            const auto format = static_cast<GLenum>(r.u32());
+            const std::uint32_t length = r.u32();
+            const char* binary = r.take(length);
+            if (!binary || length == 0) return false;
+
+            GLuint program = glCreateProgram();
+            if (separable) glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+            glProgramBinary(program, format, binary, static_cast<GLsizei>(length));
+
+            GLint ok = 0;
+            glGetProgramiv(program, GL_LINK_STATUS, &ok);
+            if (!ok) {
+                AUTOGL_LOG_ERROR("Replay", "driver rejected captured program " + std::to_string(name) +
+                                           " (captured with a different driver?)");
+                glDeleteProgram(program);
+                return false;
+            }
+
+            const std::uint32_t blocks = r.u32();
+            for (std::uint32_t i = 0; i < blocks && r.ok(); ++i) {
+                const GLuint index = r.u32();
+                const GLuint binding = r.u32();
+                glUniformBlockBinding(program, index, binding);
+            }
+
+            const std::uint32_t uniforms = r.u32();
+            for (std::uint32_t i = 0; i < uniforms && r.ok(); ++i) {
+                const GLint location = r.i32();
+                const UniformLayout layout = uniformLayout(static_cast<GLenum>(r.u32()));
+                const auto count = static_cast<GLsizei>(r.u32());
+                const char* value = r.take(sizeof(GLuint) * static_cast<std::size_t>(layout.words) *
+                                           static_cast<std::size_t>(count));
+                if (value) setUniform(program, location, layout.base, layout.words, layout.columns, count, value);
+            }
+            programs_[name] = program;
+            break;
+        }
+        case CaptureOp::DefinePipeline: {
+            GLuint pipeline = 0;
+            glCreateProgramPipelines(1, &pipeline);
+            const std::uint32_t stages = r.u32();
+            for (std::uint32_t i = 0; i < stages && r.ok(); ++i) {
+                const GLbitfield bits = r.u32();
+                const GLuint program = r.u32();
+                glUseProgramStages(pipeline, bits, lookup(programs_, program));
+            }
+            pipelines_[name] = pipeline;
+            break;
+        }
+        case CaptureOp::DefineVertexArray: {
+            GLuint vao = 0;
+            glCreateVertexArrays(1, &vao);
+            glVertexArrayElementBuffer(vao, lookup(buffers_, r.u32()));
+
+            const std::uint32_t attribs = r.u32();
+            for (std::uint32_t i = 0; i < attribs && r.ok(); ++i) {
+                // ensureVertexArray가 쓴 순서: index, size, type, normalized, integer,
+                // relativeOffset, binding, buffer, stride, divisor, offset
+                GLint v[10];
+                for (GLint& x : v) x = r.i32();
+                const auto offset = static_cast<GLintptr>(r.u64());
+
+                const auto attrib = static_cast<GLuint>(v[0]);
+                const auto slot   = static_cast<GLuint>(v[6]);
+                const auto type   = static_cast<GLenum>(v[2]);
+                const auto relativeOffset = static_cast<GLuint>(v[5]);
+                glVertexArrayVertexBuffer(vao, slot, lookup(buffers_, static_cast<GLuint>(v[7])), offset, v[8]);
+                glVertexArrayBindingDivisor(vao, slot, static_cast<GLuint>(v[9]));
+                if (v[4]) glVertexArrayAttribIFormat(vao, attrib, v[1], type, relativeOffset);
+                else      glVertexArrayAttribFormat(vao, attrib, v[1], type, v[3] ? GL_TRUE : GL_FALSE, relativeOffset);
+                glVertexArrayAttribBinding(vao, attrib, slot);
+                glEnableVertexArrayAttrib(vao, attrib);
+            }
+            vertexArrays_[name] = vao;
+            break;
+        }
+        case CaptureOp::DefineFramebuffer: {
+            GLuint fbo = 0;
+            glCreateFramebuffers(1, &fbo);
+            const std::uint32_t attachments = r.u32();
+            for (std::uint32_t i = 0; i < attachments && r.ok(); ++i) {
+                const auto attachment = static_cast<GLenum>(r.u32());
+                const GLuint texture = r.u32();
+                const GLint level = r.i32();
+                glNamedFramebufferTexture(fbo, attachment, lookup(textures_, texture), level);
+            }
+            framebuffers_[name] = fbo;
+            break;
+        }
+        default:
+            break;
+        }
+
+        if (!r.ok()) {
+            AUTOGL_LOG_ERROR("Replay", "corrupt define record for object " + std::to_string(name));
+            return false;
+        }
+        return true;
+    }
+
+    void CommandReplay::execute(const Record& rec) {
+        detail::ByteReader r(rec.data, rec.size);
+
+        switch (rec.op) {
+        case CaptureOp::Enable:  glEnable(r.u32());  break;
+        case CaptureOp::Disable: glDisable(r.u32()); break;
+        case CaptureOp::BlendFunc: {
+            const GLenum src = r.u32();
+            glBlendFunc(src, r.u32());
+            break;
+        }
+        case CaptureOp::ColorMask: {
+            GLboolean m[4];
+            for (GLboolean& b : m) b = r.u8();
+            glColorMask(m[0], m[1], m[2], m[3]);
+            break;
+        }
+        case CaptureOp::ClearColor: {
+            float c[4];
+            for (float& f : c) f = r.f32();
+            glClearColor(c[0], c[1], c[2], c[3]);
+            break;
+        }
+        case CaptureOp::Clear: glClear(r.u32()); break;
+        case CaptureOp::Viewport: {
+            GLint v[4];
+            for (GLint& x : v) x = r.i32();
+            glViewport(v[0], v[1], v[2], v[3]);
+            break;
+        }
+        case CaptureOp::MemoryBarrier: glMemoryBarrier(r.u32()); break;
+
+        case CaptureOp::UseProgram:          glUseProgram(lookup(programs_, r.u32()));          break;
+        case CaptureOp::BindProgramPipeline: glBindProgramPipeline(lookup(pipelines_, r.u32())); break;
+        case CaptureOp::UseProgramStages: {
+            const GLuint pipeline = lookup(pipelines_, r.u32());
+            const GLbitfield bits = r.u32();
+            glUseProgramStages(pipeline, bits, lookup(programs_, r.u32()));
+            break;
+        }
+        case CaptureOp::BindVertexArray: glBindVertexArray(lookup(vertexArrays_, r.u32())); break;
+        case CaptureOp::BindBuffer: {
+            const GLenum target = r.u32();
+            glBindBuffer(target, lookup(buffers_, r.u32()));
+            break;
+        }
+        case CaptureOp::BindBufferRange: {
+            const GLenum target = r.u32();
+            const GLuint index  = r.u32();
+            const GLuint buffer = lookup(buffers_, r.u32());
+            const auto offset = static_cast<GLintptr>(r.u64());
+            const auto size   = static_cast<GLsizeiptr>(r.u64());
+            if (size > 0) glBindBufferRange(target, index, buffer, offset, size);
+            else          glBindBufferBase(target, index, buffer);
+            break;
+        }
+        case CaptureOp::BindImageTexture: {
+            const GLuint unit    = r.u32();
+            const GLuint texture = lookup(textures_, r.u32());
+            const GLint level    = r.i32();
+            const GLboolean layered = r.u8();
+            const GLint layer    = r.i32();
+            const GLenum access  = r.u32();
+            glBindImageTexture(unit, texture, level, layered, layer, access, r.u32());
+            break;
+        }
+        case CaptureOp::BindFramebuffer: {
+            const GLenum target = r.u32();
+            glBindFramebuffer(target, lookup(framebuffers_, r.u32()));
+            break;
+        }
+
+        case CaptureOp::DrawArrays: {
+            const GLenum mode = r.u32();
+            const GLint first = r.i32();
+            const GLsizei count = r.i32();
+            glDrawArraysInstanced(mode, first, count, r.i32());
+            break;
+        }
+        case CaptureOp::DrawElements: {
+            const GLenum mode = r.u32();
+            const GLsizei count = r.i32();
+            const GLenum type = r.u32();
+            const auto offset = static_cast<std::uintptr_t>(r.u64());
+            glDrawElementsInstanced(mode, count, type, reinterpret_cast<const void*>(offset), r.i32());
+            break;
+        }
+        case CaptureOp::MultiDrawArraysIndirect: {
+            const GLenum mode = r.u32();
+            const auto offset = static_cast<std::uintptr_t>(r.u64());
+            const GLsizei drawCount = r.i32();
+            glMultiDrawArraysIndirect(mode, reinterpret_cast<const void*>(offset), drawCount, r.i32());
+            break;
+        }
+        case CaptureOp::MultiDrawElementsIndirect: {
+            const GLenum mode = r.u32();
+            const GLenum type = r.u32();
+            const auto offset = static_cast<std::uintptr_t>(r.u64());
+            const GLsizei drawCount = r.i32();
+            glMultiDrawElementsIndirect(mode, type, reinterpret_cast<const void*>(offset), drawCount, r.i32());
+            break;
+        }
+        case CaptureOp::MultiDrawArraysIndirectCount:
+        case CaptureOp::MultiDrawElementsIndirectCount: {
+            const bool indexed = rec.op == CaptureOp::MultiDrawElementsIndirectCount;
+            const GLenum mode = r.u32();
+            const GLenum type = indexed ? r.u32() : GL_NONE;
+            const auto* indirect = reinterpret_cast<const void*>(static_cast<std::uintptr_t>(r.u64()));
+            const auto drawCount = static_cast<GLintptr>(r.u64());
+            const GLsizei maxDrawCount = r.i32();
+            const GLsizei stride = r.i32();
+            // 재생 컨텍스트에 없으면 최대 개수만큼 그림 (남는 명령은 instanceCount 0이라 결과가 같음)
+            if (!QueryExtensions().indirectCount) {
+                if (indexed) glMultiDrawElementsIndirect(mode, type, indirect, maxDrawCount, stride);
+                else         glMultiDrawArraysIndirect(mode, indirect, maxDrawCount, stride);
+            } else if (indexed) {
+                glMultiDrawElementsIndirectCount(mode, type, indirect, drawCount, maxDrawCount, stride);
+            } else {
+                glMultiDrawArraysIndirectCount(mode, indirect, drawCount, maxDrawCount, stride);
+            }
+            break;
+        }
+        case CaptureOp::DispatchCompute: {
+            const GLuint x = r.u32();
+            const GLuint y = r.u32();
+            glDispatchCompute(x, y, r.u32());
+            break;
+        }
+
+        case CaptureOp::ProgramUniform: {
+            const GLuint program = lookup(programs_, r.u32());
+            const GLint location = r.i32();
+            const char base = static_cast<char>(r.u8());
+            const int n = r.u8();
+            const GLsizei count = r.i32();
+            const char* value = r.take(sizeof(GLuint) * static_cast<std::size_t>(n) * static_cast<std::size_t>(count));
+            if (program && value) setUniform(program, location, base, n, 0, count, value);
+            break;
+        }
+
+        case CaptureOp::NamedBufferSubData: {
+            const GLuint buffer = lookup(buffers_, r.u32());
+            const auto offset = static_cast<GLintptr>(r.u64());
+            const auto size   = static_cast<GLsizeiptr>(r.u64());
+            const char* data  = r.take(static_cast<std::size_t>(size));
+            if (buffer && data) glNamedBufferSubData(buffer, offset, size, data);
+            break;
+        }
+        case CaptureOp::ClearNamedBufferSubData: {
+            const GLuint buffer = lookup(buffers_, r.u32());
+            const GLenum internalFormat = r.u32();
+            const auto offset = static_cast<GLintptr>(r.u64());
+            const auto size   = static_cast<GLsizeiptr>(r.u64());
+            const GLenum format = r.u32();
+            const GLenum type   = r.u32();
+            const std::uint32_t bytes = r.u32();
+            const char* data = bytes ? r.take(bytes) : nullptr;
+            if (!buffer) break;
+            if (size > 0) glClearNamedBufferSubData(buffer, internalFormat, offset, size, format, type, data);
+            else          glClearNamedBufferData(buffer, internalFormat, format, type, data);
+            break;
+        }
+        case CaptureOp::CopyNamedBufferSubData: {
+            const GLuint read  = lookup(buffers_, r.u32());
+            const GLuint write = lookup(buffers_, r.u32());
+            const auto readOffset  = static_cast<GLintptr>(r.u64());
+            const auto writeOffset = static_cast<GLintptr>(r.u64());
+            const auto size = static_cast<GLsizeiptr>(r.u64());
+            if (read && write) glCopyNamedBufferSubData(read, write, readOffset, writeOffset, size);
+            break;
+        }
+        case CaptureOp::ClearTexImage: {
+            const GLuint texture = lookup(textures_, r.u32());
+            const GLint level = r.i32();
+            const GLenum format = r.u32();
+            const GLenum type = r.u32();
+            const std::uint32_t bytes = r.u32();
+            const char* data = bytes ? r.take(bytes) : nullptr;
+            if (texture) glClearTexImage(texture, level, format, type, data);
+            break;
+        }
+        case CaptureOp::ClearNamedFramebufferfv: {
+            const GLuint fbo = lookup(framebuffers_, r.u32());
+            const GLenum buffer = r.u32();
+            const GLint drawBuffer = r.i32();
+            GLfloat value[4];
+            for (GLfloat& f : value) f = r.f32();
+            glClearNamedFramebufferfv(fbo, buffer, drawBuffer, value);
+            break;
+        }
+        case CaptureOp::BlitNamedFramebuffer: {
+            const GLuint read = lookup(framebuffers_, r.u32());
+            const GLuint draw = lookup(framebuffers_, r.u32());
+            GLint v[8];
+            for (GLint& x : v) x = r.i32();
+            const GLbitfield mask = r.u32();
+            glBlitNamedFramebuffer(read, draw, v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], mask, r.u32());
+            break;
+        }
+        case CaptureOp::CopyImageSubData: {
+            const GLuint src = lookup(textures_, r.u32());
+            const GLenum srcTarget = r.u32();
+            GLint s[4];
+            for (GLint& x : s) x = r.i32();
+            const GLuint dst = lookup(textures_, r.u32());
+            const GLenum dstTarget = r.u32();
+            GLint d[7];
+            for (GLint& x : d) x = r.i32();
+            if (src && dst) {
+                glCopyImageSubData(src, srcTarget, s[0], s[1], s[2], s[3],
+                                   dst, dstTarget, d[0], d[1], d[2], d[3], d[4], d[5], d[6]);
+            }
+            break;
+        }
+        case CaptureOp::NamedFramebufferTexture: {
+            const GLuint fbo = lookup(framebuffers_, r.u32());
+            const GLenum attachment = r.u32();
+            const GLuint texture = lookup(textures_, r.u32());
+            const GLint level = r.i32();
+            if (fbo) glNamedFramebufferTexture(fbo, attachment, texture, level);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    void CommandReplay::release() {
+        for (auto& [captured, name] : buffers_)      glDeleteBuffers(1, &name);
+        for (auto& [captured, name] : textures_)     glDeleteTextures(1, &name);
+        for (auto& [captured, name] : programs_)     glDeleteProgram(name);
+        for (auto& [captured, name] : pipelines_)    glDeleteProgramPipelines(1, &name);
+        for (auto& [captured, name] : vertexArrays_) glDeleteVertexArrays(1, &name);
+        for (auto& [captured, name] : framebuffers_) glDeleteFramebuffers(1, &name);
+        buffers_.clear();
+        textures_.clear();
+        programs_.clear();
+        pipelines_.clear();
+        vertexArrays_.clear();
+        framebuffers_.clear();
+    }
+
+} // namespace AutoGL::GL
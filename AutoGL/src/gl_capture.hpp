@@ -0,0 +1,142 @@
+// src/gl_capture.hpp
+#pragma once
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mapped_file.hpp"
+
+namespace AutoGL::GL {
+
+    // GL 명령 캡처 파일 (.aglc): 헤더 뒤에 [u8 op][u32 payload 크기][payload] 레코드가 이어짐.
+    // 객체(버퍼/텍스처/프로그램/pipeline/VAO/FBO)는 캡처 중 처음 참조될 때 그 시점 내용으로
+    // Define 레코드를 남기므로 파일 하나만으로 재생 가능 (프로그램은 드라이버 바이너리라 같은 드라이버 전용)
+    enum class CaptureOp : std::uint8_t {
+        FrameEnd = 1,
+
+        DefineBuffer = 16,
+        DefineTexture,
+        DefineProgram,
+        DefinePipeline,
+        DefineVertexArray,
+        DefineFramebuffer,
+
+        Enable = 32,
+        Disable,
+        BlendFunc,
+        ColorMask,
+        ClearColor,
+        Clear,
+        Viewport,
+        MemoryBarrier,
+
+        UseProgram = 48,
+        BindProgramPipeline,
+        UseProgramStages,
+        BindVertexArray,
+        BindBuffer,
+        BindBufferRange,        // glBindBufferBase는 size 0으로 기록
+        BindImageTexture,
+        BindFramebuffer,
+
+        DrawArrays = 64,
+        DrawElements,
+        MultiDrawArraysIndirect,
+        MultiDrawElementsIndirect,
+        DispatchCompute,
+        MultiDrawArraysIndirectCount,       // draw 개수는 GL_PARAMETER_BUFFER의 오프셋으로 기록
+        MultiDrawElementsIndirectCount,
+
+        ProgramUniform = 80,    // 성분 타입/수, 배열 길이, 값 (glProgramUniform{1..4}{f,i,ui}[v])
+
+        NamedBufferSubData = 96,
+        ClearNamedBufferSubData,    // glClearNamedBufferData는 전체 범위로 기록
+        CopyNamedBufferSubData,
+        ClearTexImage,
+        ClearNamedFramebufferfv,
+        BlitNamedFramebuffer,
+        CopyImageSubData,
+        NamedFramebufferTexture,
+    };
+
+    // 렌더 스레드의 GL 호출을 glad 함수 포인터를 바꿔 끼운 래퍼로 기록.
+    // 래퍼는 begin을 호출한 스레드의 호출만 기록하고 (컴파일 워커의 공유 컨텍스트는 그대로 통과),
+    // query/fence/glGet*처럼 렌더링 결과에 영향이 없는 호출은 기록하지 않음
+    class CommandCapture {
+    public:
+        CommandCapture() = default;
+        CommandCapture(const CommandCapture&) = delete;
+        CommandCapture& operator=(const CommandCapture&) = delete;
+        ~CommandCapture();
+
+        // 프레임 시작에서 호출 (GL 컨텍스트가 current인 스레드). 현재 바인딩/상태를 먼저 기록
+        bool begin(const std::string& path, int frames, int width, int height);
+        bool active() const noexcept { return active_; }
+
+        // 프레임 끝에서 호출. frames 프레임을 채우면 파일을 쓰고 끝냄 (끝났으면 true)
+        bool endFrame();
+
+        // 채우지 못했어도 지금까지 기록한 프레임으로 파일을 씀 (루프 종료 시)
+        void finish();
+
+    private:
+        std::string path_;
+        int frames_   = 0;
+        int recorded_ = 0;
+        bool active_  = false;
+    };
+
+    // 캡처 파일을 현재 컨텍스트에서 다시 실행. 캡처한 객체 이름은 새로 만든 객체로 대응시킴
+    class CommandReplay {
+    public:
+        CommandReplay() = default;
+        CommandReplay(const CommandReplay&) = delete;
+        CommandReplay& operator=(const CommandReplay&) = delete;
+
+        // 파일을 읽고 레코드를 프레임별로 나눔 (GL 호출 없음)
+        bool load(const std::string& path);
+
+        int width() const noexcept { return width_; }
+        int height() const noexcept { return height_; }
+        std::size_t frameCount() const noexcept { return frames_.size(); }
+        std::size_t bytes() const noexcept { return file_.size(); }
+
+        // Define 레코드로 객체를 모두 만들고 내용을 올림 (프레임 재생 전에 한 번).
+        // 객체는 처음 참조되기 직전의 내용으로 기록되므로 앞당겨 만들어도 결과가 같음
+        bool prepare();
+
+        // 프레임 하나의 명령을 그대로 다시 호출 (swap은 호출하는 쪽에서)
+        void playFrame(std::size_t index);
+
+        // 만든 객체 삭제 (GL 컨텍스트가 current인 스레드에서)
+        void release();
+
+    private:
+        struct Record {
+            CaptureOp op;
+            const char* data;
+            std::uint32_t size;
+        };
+
+        MappedFile file_;
+        int width_  = 0;
+        int height_ = 0;
+        std::vector<Record> defines_;
+        std::vector<std::vector<Record>> frames_;
+
+        // 캡처 당시 이름 -> 재생 컨텍스트 이름
+        std::unordered_map<GLuint, GLuint> buffers_;
+        std::unordered_map<GLuint, GLuint> textures_;
+        std::unordered_map<GLuint, GLuint> programs_;
+        std::unordered_map<GLuint, GLuint> pipelines_;
+        std::unordered_map<GLuint, GLuint> vertexArrays_;
+        std::unordered_map<GLuint, GLuint> framebuffers_;
+
+        bool define(const Record& r);
+        void execute(const Record& r);
+    };
+
+} // namespace AutoGL::GL
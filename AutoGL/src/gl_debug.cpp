@@ -0,0 +1,152 @@
+// src/gl_debug.cpp
+#include "gl_debug.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace AutoGL::GL {
+
+    namespace {
+        struct DebugState {
+            std::mutex mutex;
+            // (source, type, id) -> 수신 횟수
+            std::unordered_map<std::uint64_t, std::uint32_t> seen;
+            std::atomic<std::uint64_t> errorCount{0};
+            std::atomic<GLDebugMode> mode{GLDebugMode::Off};
+        };
+
+        DebugState& debugState() {
+            static DebugState s;
+            return s;
+        }
+
+        constexpr const char* sourceToString(GLenum source) {
+            switch (source) {
+                case GL_DEBUG_SOURCE_API:             return "API";
+                case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "WindowSystem";
+                case GL_DEBUG_SOURCE_SHADER_COMPILER: return "ShaderCompiler";
+                case GL_DEBUG_SOURCE_THIRD_PARTY:     return "ThirdParty";
+                case GL_DEBUG_SOURCE_APPLICATION:     return "Application";
+                default:                              return "Other";
+            }
+        }
+
+        constexpr const char* typeToString(GLenum type) {
+            switch (type) {
+                case GL_DEBUG_TYPE_ERROR:               return "Error";
+                case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "Deprecated";
+                case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "Undefined";
+                case GL_DEBUG_TYPE_PORTABILITY:         return "Portability";
+                case GL_DEBUG_TYPE_PERFORMANCE:         return "Performance";
+                case GL_DEBUG_TYPE_MARKER:              return "Marker";
+                default:                                return "Other";
+            }
+        }
+
+        constexpr std::uint64_t messageKey(GLenum source, GLenum type, GLuint id) {
+            return (static_cast<std::uint64_t>(source & 0xFFFF) << 48)
+                 | (static_cast<std::uint64_t>(type   & 0xFFFF) << 32)
+                 |  static_cast<std::uint64_t>(id);
+        }
+
+        // Async 모드에서는 드라이버 스레드에서 호출될 수 있음
+        void GLAPIENTRY debugCallback(GLenum source, GLenum type, GLuint id,
+                                      GLenum severity, GLsizei /*length*/,
+                                      const GLchar* message, const void* /*user*/) {
+            auto& st = debugState();
+
+            if (type == GL_DEBUG_TYPE_ERROR) {
+                st.errorCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(st.mutex);
+                // 같은 메시지는 처음 한 번만 출력
+                if (++st.seen[messageKey(source, type, id)] > 1) return;
+            }
+
+            std::string text = std::string("[") + sourceToString(source) + "/"
+                + typeToString(type) + " #" + std::to_string(id) + "] "
+                + (message ? message : "");
+
+            switch (severity) {
+                case GL_DEBUG_SEVERITY_HIGH:
+                    AUTOGL_LOG_ERROR("GLDebug", text);
+                    break;
+                case GL_DEBUG_SEVERITY_MEDIUM:
+                    AUTOGL_LOG_WARN("GLDebug", text);
+                    break;
+                case GL_DEBUG_SEVERITY_LOW:
+                    AUTOGL_LOG_INFO("GLDebug", text);
+                    break;
+                default:
+                    AUTOGL_LOG_DEBUG("GLDebug", text);
+                    break;
+            }
+        }
+    }
+
+    void InstallDebugOutput(GLDebugMode mode) {
+        debugState().mode.store(mode, std::memory_order_relaxed);
+        if (mode == GLDebugMode::Off) {
+            glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+            glDisable(GL_DEBUG_OUTPUT);
+            return;
+        }
+
+        GLint flags = 0;
+        glGetIntegerv(GL_CONTEXT_FLAGS, &flags);
+        if (!(flags & GL_CONTEXT_FLAG_DEBUG_BIT)) {
+            AUTOGL_LOG_WARN("GLDebug",
+                "context is not a debug context, driver may report fewer messages");
+        }
+
+        glEnable(GL_DEBUG_OUTPUT);
+        if (mode == GLDebugMode::Sync) {
+            // 에러를 일으킨 GL 호출 안에서 콜백이 불리므로 디버거로 위치 추적 가능
+            glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        } else {
+            glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        }
+
+        glDebugMessageCallback(debugCallback, nullptr);
+
+        // notification은 매 프레임 쏟아지는 경우가 많아 드라이버 단에서 차단
+        glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE,
+                              GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+
+        AUTOGL_LOG_INFO("GLDebug",
+            mode == GLDebugMode::Sync ? "debug output enabled (synchronous)"
+                                      : "debug output enabled");
+    }
+
+    GLDebugMode ActiveDebugMode() noexcept {
+        return debugState().mode.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t DebugErrorCount() noexcept {
+        return debugState().errorCount.load(std::memory_order_relaxed);
+    }
+
+    void LogDebugSummary() {
+        auto& st = debugState();
+        std::lock_guard<std::mutex> lock(st.mutex);
+
+        for (const auto& [key, count] : st.seen) {
+            if (count <= 1) continue;
+
+            const auto source = static_cast<GLenum>((key >> 48) & 0xFFFF);
+            const auto type   = static_cast<GLenum>((key >> 32) & 0xFFFF);
+            const auto id     = static_cast<GLuint>(key & 0xFFFFFFFFu);
+
+            AUTOGL_LOG_INFO("GLDebug",
+                std::string("[") + sourceToString(source) + "/" + typeToString(type)
+                + " #" + std::to_string(id) + "] repeated "
+                + std::to_string(count - 1) + " more times");
+        }
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,22 @@
+// src/gl_debug.hpp
+#pragma once
+#include <cstdint>
+#include <glad/glad.h>
+#include <AutoGL/AutoGL.hpp>
+
+namespace AutoGL::GL {
+
+    // 컨텍스트 생성 직후 호출. Off면 GL_DEBUG_OUTPUT 자체를 끈다.
+    void InstallDebugOutput(GLDebugMode mode);
+
+    // 마지막 InstallDebugOutput의 모드 (호출 전이면 Off)
+    GLDebugMode ActiveDebugMode() noexcept;
+
+    // 지금까지 콜백으로 들어온 GL_DEBUG_TYPE_ERROR 개수.
+    // Sync 모드에서는 호출 직후 값을 비교해 특정 GL 호출의 실패 여부를 알 수 있다.
+    std::uint64_t DebugErrorCount() noexcept;
+
+    // 중복 제거로 생략된 메시지 횟수를 로그로 남김
+    void LogDebugSummary();
+
+} // namespace AutoGL::GL
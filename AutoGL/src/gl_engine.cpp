@@ -6,17 +6,34 @@
 
 #include "glsl_loader.hpp"
 #include "shader_regex.hpp"
+#include "gl_debug.hpp"
+#include "gl_ext.hpp"
+#include "program_binary_cache.hpp"
+#include "image_writer.hpp"
+#include "json_util.hpp"
+#include "gl_query.hpp"
+#include "gl_late_latch.hpp"
+#include "gl_instance_buffers.hpp"
+#include "stats_util.hpp"
 #include <AutoGL/Log.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <unordered_map>
+#include <unordered_set>
+#include <thread>
 
 namespace fs = std::filesystem;
 
 namespace AutoGL::detail {
 
-    void createFullscreenQuad(InternalGLState& state) {
+    void createQuadBuffers(GLuint& vao, GLuint& vbo) {
         float vertices[] = {
             -1.f,-1.f,  0.f,0.f,
                 1.f,-1.f,  1.f,0.f,
@@ -26,20 +43,31 @@ namespace AutoGL::detail {
             -1.f, 1.f,  0.f,1.f
         };
 
-        glGenVertexArrays(1, &state.quadVAO);
-        glGenBuffers(1, &state.quadVBO);
+        // DSA: 바인딩 상태를 건드리지 않고 VAO/VBO 구성
+        glCreateVertexArrays(1, &vao);
+        glCreateBuffers(1, &vbo);
 
-        glBindVertexArray(state.quadVAO);
-        glBindBuffer(GL_ARRAY_BUFFER, state.quadVBO);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glNamedBufferStorage(vbo, sizeof(vertices), vertices, 0);
 
-        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
+        glVertexArrayVertexBuffer(vao, 0, vbo, 0, 4 * sizeof(float));
 
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)(2 * sizeof(float)));
-        glEnableVertexAttribArray(1);
+        glVertexArrayAttribFormat(vao, 0, 2, GL_FLOAT, GL_FALSE, 0);
+        glVertexArrayAttribBinding(vao, 0, 0);
+        glEnableVertexArrayAttrib(vao, 0);
 
-        glBindVertexArray(0);
+        glVertexArrayAttribFormat(vao, 1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float));
+        glVertexArrayAttribBinding(vao, 1, 0);
+        glEnableVertexArrayAttrib(vao, 1);
+    }
+
+    void createFullscreenQuad(InternalGLState& state) {
+        createQuadBuffers(state.quadVAO, state.quadVBO);
+    }
+
+    // 콜백은 메인(이벤트) 스레드에서만 호출됨: eventInput을 고치고 스냅샷을 발행한 뒤 렌더 스레드를 깨움
+    void publishInput(InternalGLState& st) {
+        st.input.store(st.eventInput);
+        st.wake.notify();
     }
 
     void mouse_button_callback(GLFWwindow* window, int button, int action, int /*mods*/) {
@@ -47,19 +75,20 @@ namespace AutoGL::detail {
         if (!st) return;
 
         if (button == GLFW_MOUSE_BUTTON_LEFT) {
+            InputSnapshot& in = st->eventInput;
             if (action == GLFW_PRESS) {
-                st->mouseDown = true;
+                in.mouseDown = true;
                 double cx, cy;
                 glfwGetCursorPos(window, &cx, &cy);
 
-                int w, h;
-                glfwGetFramebufferSize(window, &w, &h);
-
-                st->clickX = cx;
-                st->clickY = h - cy;
+                in.clickX = cx;
+                in.clickY = in.fbHeight - cy;
             } else if (action == GLFW_RELEASE) {
-                st->mouseDown = false;
+                in.mouseDown = false;
             }
+            in.inputTime = glfwGetTime();
+            ++in.inputSerial;
+            publishInput(*st);
         }
     }
 
@@ -67,189 +96,225 @@ namespace AutoGL::detail {
         auto* st = static_cast<InternalGLState*>(glfwGetWindowUserPointer(window));
         if (!st) return;
 
-        int w, h;
-        glfwGetFramebufferSize(window, &w, &h);
+        InputSnapshot& in = st->eventInput;
+        in.mouseX = xpos;
+        in.mouseY = in.fbHeight - ypos;
+        in.inputTime = glfwGetTime();
+        ++in.inputSerial;
+        publishInput(*st);
+    }
+
+    void framebuffer_size_callback(GLFWwindow* window, int w, int h) {
+        auto* st = static_cast<InternalGLState*>(glfwGetWindowUserPointer(window));
+        if (!st) return;
 
-        st->mouseX = xpos;
-        st->mouseY = h - ypos;
+        st->eventInput.fbWidth  = w;
+        st->eventInput.fbHeight = h;
+        ++st->eventInput.redrawSerial;
+        publishInput(*st);
     }
 
-    void setBuiltinUniforms(unsigned int program, InternalGLState& st) {
-        // 시간
-        float timeNow = static_cast<float>(glfwGetTime() - st.startTime);
+    // 창이 다시 노출되거나 최소화에서 복원되면 내용이 버려졌을 수 있으므로 다시 그림
+    void window_refresh_callback(GLFWwindow* window) {
+        auto* st = static_cast<InternalGLState*>(glfwGetWindowUserPointer(window));
+        if (!st) return;
 
-        GLint uTime = glGetUniformLocation(program, "iTime");
-        if (uTime >= 0) {
-            glUniform1f(uTime, timeNow);
-        }
+        ++st->eventInput.redrawSerial;
+        publishInput(*st);
+    }
 
-        double now = glfwGetTime();
-        st.deltaTime = now - st.prevFrameTime;
-        st.prevFrameTime = now;
+    void window_iconify_callback(GLFWwindow* window, int iconified) {
+        auto* st = static_cast<InternalGLState*>(glfwGetWindowUserPointer(window));
+        if (!st) return;
 
-        GLint uTimeDelta = glGetUniformLocation(program, "iTimeDelta");
-        if (uTimeDelta >= 0) {
-            glUniform1f(uTimeDelta, static_cast<float>(st.deltaTime));
-        }
+        st->eventInput.hidden = iconified || !glfwGetWindowAttrib(window, GLFW_VISIBLE);
+        ++st->eventInput.redrawSerial;
+        publishInput(*st);
+    }
 
-        // frame
-        st.frameCount++;
-        GLint uFrame = glGetUniformLocation(program, "iFrame");
-        if (uFrame >= 0) {
-            glUniform1i(uFrame, st.frameCount);
-        }
+    void window_focus_callback(GLFWwindow* window, int focused) {
+        auto* st = static_cast<InternalGLState*>(glfwGetWindowUserPointer(window));
+        if (!st) return;
 
-        // GlobalTime alias
-        GLint uGlobalTime = glGetUniformLocation(program, "iGlobalTime");
-        if (uGlobalTime >= 0) {
-            glUniform1f(uGlobalTime, timeNow);
+        st->eventInput.focused = focused != 0;
+        publishInput(*st);
+    }
+
+    void key_callback(GLFWwindow* window, int key, int /*scancode*/, int action, int /*mods*/) {
+        auto* st = static_cast<InternalGLState*>(glfwGetWindowUserPointer(window));
+        if (!st) return;
+
+        if (key == GLFW_KEY_F2 && action == GLFW_PRESS) {
+            ++st->eventInput.heatmapToggles;
+            publishInput(*st);
         }
+    }
 
-        // resolution
-        int w, h;
-        glfwGetFramebufferSize(st.window, &w, &h);
-        GLint uRes = glGetUniformLocation(program, "iResolution");
-        if (uRes >= 0) {
-            glUniform2f(uRes, static_cast<float>(w), static_cast<float>(h));
+    // 렌더 스레드: 프레임 시작에 최신 입력 스냅샷 하나를 가져와서 렌더 쪽 사본에 반영
+    void syncInput(InternalGLState& st) {
+        const InputSnapshot in = st.input.load();
+
+        st.mouseX    = in.mouseX;
+        st.mouseY    = in.mouseY;
+        st.clickX    = in.clickX;
+        st.clickY    = in.clickY;
+        st.mouseDown = in.mouseDown;
+        st.inputTime = in.inputTime;
+        st.fbWidth   = in.fbWidth;
+        st.fbHeight  = in.fbHeight;
+        st.focused   = in.focused;
+        st.hidden    = in.hidden;
+
+        if (in.inputSerial != st.seenInputSerial) {
+            st.seenInputSerial = in.inputSerial;
+            st.inputChanged    = true;
+        }
+        if (in.redrawSerial != st.seenRedrawSerial) {
+            st.seenRedrawSerial = in.redrawSerial;
+            st.redrawRequested  = true;
+        }
+        if (in.heatmapToggles != st.seenHeatmapToggles) {
+            st.heatmapToggled     = ((in.heatmapToggles - st.seenHeatmapToggles) & 1u) != 0;
+            st.seenHeatmapToggles = in.heatmapToggles;
         }
+    }
 
-        // mouse
-        GLint uMouse = glGetUniformLocation(program, "iMouse");
-        if (uMouse >= 0) {
-            glUniform4f(
-                uMouse,
-                static_cast<float>(st.mouseX),
-                static_cast<float>(st.mouseY),
-                st.mouseDown ? static_cast<float>(st.clickX) : 0.0f,
-                st.mouseDown ? static_cast<float>(st.clickY) : 0.0f
-            );
+    BuiltinUniformLocations QueryBuiltinUniforms(unsigned int program) {
+        BuiltinUniformLocations locs;
+        if (program == 0) return locs;
+
+        locs.iTime       = glGetUniformLocation(program, "iTime");
+        locs.iTimeDelta  = glGetUniformLocation(program, "iTimeDelta");
+        locs.iFrame      = glGetUniformLocation(program, "iFrame");
+        locs.iGlobalTime = glGetUniformLocation(program, "iGlobalTime");
+        locs.iResolution = glGetUniformLocation(program, "iResolution");
+        locs.iMouse      = glGetUniformLocation(program, "iMouse");
+        locs.iDate       = glGetUniformLocation(program, "iDate");
+        locs.iFrameRate  = glGetUniformLocation(program, "iFrameRate");
+        locs.iRandom     = glGetUniformLocation(program, "iRandom");
+        locs.iMeshIndexCount = glGetUniformLocation(program, "iMeshIndexCount");
+
+        for (int i = 0; i < 4; ++i) {
+            std::string name = "iChannelResolution[" + std::to_string(i) + "]";
+            locs.iChannelResolution[i] = glGetUniformLocation(program, name.c_str());
+
+            std::string tname = "iChannelTime[" + std::to_string(i) + "]";
+            locs.iChannelTime[i] = glGetUniformLocation(program, tname.c_str());
         }
 
-        // date
-        {
-            time_t t = time(nullptr);
-            tm* lt = localtime(&t);
-
-            float seconds = lt->tm_hour * 3600.0f +
-                            lt->tm_min * 60.0f +
-                            lt->tm_sec;
-
-            GLint uDate = glGetUniformLocation(program, "iDate");
-            if (uDate >= 0) {
-                glUniform4f(
-                    uDate,
-                    static_cast<float>(lt->tm_year + 1900),
-                    static_cast<float>(lt->tm_mon + 1),
-                    static_cast<float>(lt->tm_mday),
-                    seconds
-                );
-            }
+        // late-latch 모드로 빌드된 stage는 iMouse가 uniform block 멤버
+        const GLuint block = glGetUniformBlockIndex(program, kLateLatchBlockName);
+        if (block != GL_INVALID_INDEX) {
+            glUniformBlockBinding(program, block, kLateLatchBlockBinding);
+            locs.iMouseBlock = static_cast<GLint>(block);
         }
 
-        // frame rate
-        float frameRate = (st.deltaTime > 0.0)
+        return locs;
+    }
+
+    // 프레임마다 한 번: 시간/프레임/랜덤 값 갱신
+    void advanceFrameState(InternalGLState& st) {
+        const double now = glfwGetTime();
+
+        st.deltaTime     = now - st.prevFrameTime;
+        st.prevFrameTime = now;
+        st.frameCount++;
+        st.randomValue   = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+    }
+
+    // shadertoy iMouse: xy = 현재 위치, zw = 누르고 있는 동안 클릭 위치
+    void packMouse(double x, double y, bool down, double clickX, double clickY, float out[4]) {
+        out[0] = static_cast<float>(x);
+        out[1] = static_cast<float>(y);
+        out[2] = down ? static_cast<float>(clickX) : 0.0f;
+        out[3] = down ? static_cast<float>(clickY) : 0.0f;
+    }
+
+    // 현재 상태에서 builtin 값을 한 번 계산 (localtime 등은 프로그램 수와 무관하게 프레임당 한 번)
+    BuiltinUniformValues captureBuiltinValues(const InternalGLState& st) {
+        BuiltinUniformValues v;
+        const double now = st.prevFrameTime;
+
+        // 시간
+        v.time      = static_cast<float>(now - st.startTime);
+        v.timeDelta = static_cast<float>(st.deltaTime);
+        v.frame     = st.frameCount;
+        v.frameRate = (st.deltaTime > 0.0)
             ? static_cast<float>(1.0 / st.deltaTime)
             : 0.0f;
+        v.random    = st.randomValue;
 
-        GLint uRate = glGetUniformLocation(program, "iFrameRate");
-        if (uRate >= 0) {
-            glUniform1f(uRate, frameRate);
-        }
+        // resolution
+        v.resolution[0] = static_cast<float>(st.fbWidth);
+        v.resolution[1] = static_cast<float>(st.fbHeight);
 
-        // random
-        st.randomValue = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
-        GLint uRand = glGetUniformLocation(program, "iRandom");
-        if (uRand >= 0) {
-            glUniform1f(uRand, st.randomValue);
-        }
+        // mouse
+        packMouse(st.mouseX, st.mouseY, st.mouseDown, st.clickX, st.clickY, v.mouse);
+
+        // date
+        time_t t = time(nullptr);
+        tm* lt = localtime(&t);
+        v.date[0] = static_cast<float>(lt->tm_year + 1900);
+        v.date[1] = static_cast<float>(lt->tm_mon + 1);
+        v.date[2] = static_cast<float>(lt->tm_mday);
+        v.date[3] = lt->tm_hour * 3600.0f + lt->tm_min * 60.0f + lt->tm_sec;
 
         // iChannelResolution, iChannelTime
         for (int i = 0; i < 4; ++i) {
-            std::string name = "iChannelResolution[" + std::to_string(i) + "]";
-            GLint loc = glGetUniformLocation(program, name.c_str());
-            if (loc >= 0) {
-                glUniform3f(loc,
-                    static_cast<float>(st.texWidth[i]),
-                    static_cast<float>(st.texHeight[i]),
-                    1.0f);
-            }
-
-            std::string tname = "iChannelTime[" + std::to_string(i) + "]";
-            GLint tloc = glGetUniformLocation(program, tname.c_str());
-            if (tloc >= 0) {
-                glUniform1f(tloc,
-                    static_cast<float>(glfwGetTime() - st.channelTime[i]));
-            }
+            v.channelResolution[i][0] = static_cast<float>(st.texWidth[i]);
+            v.channelResolution[i][1] = static_cast<float>(st.texHeight[i]);
+            v.channelResolution[i][2] = 1.0f;
+            v.channelTime[i] = static_cast<float>(now - st.channelTime[i]);
         }
 
-        GLenum err;
-        while ((err = glGetError()) != GL_NO_ERROR) {
-            AUTOGL_LOG_ERROR("EngineGL",
-                "GL error in setBuiltinUniforms code " + std::to_string(err));
-        }
+        return v;
     }
 
-    
-    bool hasComputeStage(unsigned int program) {
-        GLint numShaders = 0;
-        glGetProgramiv(program, GL_ATTACHED_SHADERS, &numShaders);
-        if (numShaders <= 0) return false;
-
-        std::vector<GLuint> attached(static_cast<std::size_t>(numShaders));
-        glGetAttachedShaders(program, numShaders, nullptr, attached.data());
-
-        bool hasCompute   = false;
-        bool hasNonCompute = false;
-
-        for (GLuint s : attached) {
-            GLint type = 0;
-            glGetShaderiv(s, GL_SHADER_TYPE, &type);
-            if (type == GL_COMPUTE_SHADER) {
-                hasCompute = true;
-            } else {
-                hasNonCompute = true;
+    // 위치는 QueryBuiltinUniforms로 미리 조회, 값은 DSA(glProgramUniform*)로 설정.
+    // 바인딩 상태를 바꾸지 않으므로 같은 값을 여러 stage 프로그램에 올려도 됨
+    void uploadBuiltinUniforms(unsigned int program,
+                               const BuiltinUniformLocations& locs,
+                               const BuiltinUniformValues& v) {
+        if (locs.iTime >= 0)       glProgramUniform1f(program, locs.iTime, v.time);
+        if (locs.iTimeDelta >= 0)  glProgramUniform1f(program, locs.iTimeDelta, v.timeDelta);
+        if (locs.iFrame >= 0)      glProgramUniform1i(program, locs.iFrame, v.frame);
+
+        // GlobalTime alias
+        if (locs.iGlobalTime >= 0) glProgramUniform1f(program, locs.iGlobalTime, v.time);
+
+        if (locs.iResolution >= 0) glProgramUniform2fv(program, locs.iResolution, 1, v.resolution);
+        if (locs.iMouse >= 0)      glProgramUniform4fv(program, locs.iMouse, 1, v.mouse);
+        if (locs.iDate >= 0)       glProgramUniform4fv(program, locs.iDate, 1, v.date);
+        if (locs.iFrameRate >= 0)  glProgramUniform1f(program, locs.iFrameRate, v.frameRate);
+        if (locs.iRandom >= 0)     glProgramUniform1f(program, locs.iRandom, v.random);
+
+        for (int i = 0; i < 4; ++i) {
+            if (locs.iChannelResolution[i] >= 0) {
+                glProgramUniform3fv(program, locs.iChannelResolution[i], 1, v.channelResolution[i]);
+            }
+            if (locs.iChannelTime[i] >= 0) {
+                glProgramUniform1f(program, locs.iChannelTime[i], v.channelTime[i]);
             }
         }
+    }
 
-        // “compute-only 프로그램인지” 여부 반환
-        return hasCompute && !hasNonCompute;
+    void setBuiltinUniforms(unsigned int program,
+                            const BuiltinUniformLocations& locs,
+                            InternalGLState& st) {
+        advanceFrameState(st);
+        uploadBuiltinUniforms(program, locs, captureBuiltinValues(st));
     }
 
+    
     static bool SafeDispatchCompute(GLuint program, int dummyX, int dummyY, int dummyZ) {
-        // 1) 먼저 local_size_x/y/z 파악
-        GLint computeShader = 0;
-        GLint numShaders = 0;
-        glGetProgramiv(program, GL_ATTACHED_SHADERS, &numShaders);
-
-        std::vector<GLuint> attached(numShaders);
-        glGetAttachedShaders(program, numShaders, nullptr, attached.data());
-
-        std::string computeSource;
-        for (auto s : attached) {
-            GLint type = 0;
-            glGetShaderiv(s, GL_SHADER_TYPE, &type);
-            if (type == GL_COMPUTE_SHADER) {
-                // compute shader 원본 가져오기
-                GLint len = 0;
-                glGetShaderiv(s, GL_SHADER_SOURCE_LENGTH, &len);
-                if (len > 0) {
-                    computeSource.resize(len);
-                    glGetShaderSource(s, len, nullptr, computeSource.data());
-                }
-                computeShader = s;
-                break;
-            }
-        }
-
-        // 기본값
-        int localX = 1, localY = 1, localZ = 1;
+        // 1) 링크된 프로그램에서 local_size_x/y/z 조회
+        //    (바이너리 캐시에서 로드한 프로그램은 attach된 셰이더 소스가 없음)
+        GLint localSize[3] = { 1, 1, 1 };
+        glGetProgramiv(program, GL_COMPUTE_WORK_GROUP_SIZE, localSize);
 
-        if (!computeSource.empty()) {
-            auto info = AutoGL::ParseComputeLayout(computeSource);
-            localX = info.localSizeX;
-            localY = info.localSizeY;
-            localZ = info.localSizeZ;
-        }
+        const int localX = localSize[0] > 0 ? localSize[0] : 1;
+        const int localY = localSize[1] > 0 ? localSize[1] : 1;
+        const int localZ = localSize[2] > 0 ? localSize[2] : 1;
 
         // 작업량 자동 계산 (기본 1024 항목 기준)
         const int TOTAL = 1024;
@@ -257,23 +322,26 @@ namespace AutoGL::detail {
         int dispatchY = (1 + localY - 1) / localY;
         int dispatchZ = (1 + localZ - 1) / localZ;
 
-        // 기존 GL 에러 플러시
-        GLenum err;
-        while ((err = glGetError()) != GL_NO_ERROR) {}
+        // Off 모드(no-error 컨텍스트)는 에러를 보고하지 않으므로 검사하지 않음.
+        // 그 밖에는 glGetError로 확인 (Async 콜백은 늦게 또는 다른 스레드에서 올 수 있어
+        // 에러 카운터만으로는 놓칠 수 있음). 이전 호출이 남긴 에러 플래그는 먼저 비움
+        const bool check = GL::ActiveDebugMode() != GLDebugMode::Off;
+        const std::uint64_t errorsBefore = GL::DebugErrorCount();
+        if (check) {
+            for (int i = 0; i < 8 && glGetError() != GL_NO_ERROR; ++i) {}
+        }
 
         glDispatchCompute(dispatchX, dispatchY, dispatchZ);
 
-        err = glGetError();
-        if (err != GL_NO_ERROR) {
-            AUTOGL_LOG_FATAL("Compute", "DispatchCompute failed: error " + std::to_string(err));
+        if (check && (glGetError() != GL_NO_ERROR || GL::DebugErrorCount() != errorsBefore)) {
+            AUTOGL_LOG_FATAL("Compute", "DispatchCompute failed");
             return false;
         }
 
         glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
 
-        err = glGetError();
-        if (err != GL_NO_ERROR) {
-            AUTOGL_LOG_FATAL("Compute", "MemoryBarrier failed: error " + std::to_string(err));
+        if (GL::DebugErrorCount() != errorsBefore) {
+            AUTOGL_LOG_FATAL("Compute", "MemoryBarrier failed");
             return false;
         }
 
@@ -301,16 +369,14 @@ namespace AutoGL::detail {
                 continue;
             }
 
-            glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
-
             GLint size = 0;
-            glGetBufferParameteriv(GL_SHADER_STORAGE_BUFFER, GL_BUFFER_SIZE, &size);
+            glGetNamedBufferParameteriv(ssbo, GL_BUFFER_SIZE, &size);
             if (size <= 0) {
                 AUTOGL_LOG_INFO("SSBO", "[#" + std::to_string(binding) + "] NONE");
                 continue;
             }
 
-            void* ptr = glMapBuffer(GL_SHADER_STORAGE_BUFFER, GL_READ_ONLY);
+            void* ptr = glMapNamedBufferRange(ssbo, 0, size, GL_MAP_READ_BIT);
             if (!ptr) {
                 AUTOGL_LOG_ERROR("SSBO", "Failed to map SSBO #" + std::to_string(binding));
                 continue;
@@ -411,13 +477,129 @@ namespace AutoGL::detail {
                     "[#" + std::to_string(binding) + "] UNINITIALIZED (all pattern 0xCDCDCDCD)");
             }
 
-            glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+            glUnmapNamedBuffer(ssbo);
         }
 
         if (!printedAny)
             AUTOGL_LOG_INFO("SSBO", "No SSBO found");
     }
 
+    // ---------------- 배치 리포트 ----------------
+
+    struct BatchRecord {
+        std::string path;
+        const char* kind   = "graphics";
+        const char* status = "failed";
+        ShaderBuildTimings timings;
+        double firstFrameMs = 0.0;      // 빌드 후 첫 draw/dispatch 제출부터 GPU 완료까지
+        SampleSummary gpu;              // 프레임(compute는 dispatch)당 GPU 시간
+        PipelineStatistics stats;       // 같은 구간의 호출 수 평균 (지원하지 않으면 samples == 0)
+    };
+
+    // 호출 하나당 평균 GPU 시간 (ns), 호출이 없으면 0
+    static double nsPerInvocation(double gpuMs, double invocations) {
+        return invocations > 0.0 ? gpuMs * 1.0e6 / invocations : 0.0;
+    }
+
+    // 로그용 한 줄 요약: 실제로 일어난 호출만 (graphics는 vertex/fragment/clipping, compute는 compute)
+    static std::string FormatPipelineStats(const PipelineStatistics& s) {
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(0);
+        const char* sep = "";
+        if (s.vertexInvocations > 0.0) {
+            os << "vertex " << s.vertexInvocations
+               << ", clipping " << s.clippingInputPrimitives << " -> " << s.clippingOutputPrimitives << " prims";
+            sep = ", ";
+        }
+        if (s.fragmentInvocations > 0.0) {
+            os << sep << "fragment " << s.fragmentInvocations << std::setprecision(3)
+               << " (" << nsPerInvocation(s.gpuMs, s.fragmentInvocations) << " ns each)" << std::setprecision(0);
+            sep = ", ";
+        }
+        if (s.computeInvocations > 0.0) {
+            os << sep << "compute " << s.computeInvocations << std::setprecision(3)
+               << " (" << nsPerInvocation(s.gpuMs, s.computeInvocations) << " ns each)";
+        }
+        return os.str();
+    }
+
+    static std::string glString(GLenum name) {
+        const GLubyte* s = glGetString(name);
+        return s ? std::string(reinterpret_cast<const char*>(s)) : std::string();
+    }
+
+    static std::string csvField(const std::string& s) {
+        if (s.find_first_of(",\"\n") == std::string::npos) return s;
+        std::string out = "\"";
+        for (char c : s) {
+            if (c == '"') out += '"';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    static void writeBatchCsv(std::ostream& os, const std::vector<BatchRecord>& records) {
+        os << "path,kind,status,binary_cache_hit,preprocess_ms,compile_ms,link_ms,first_frame_ms,"
+              "gpu_samples,gpu_mean_ms,gpu_median_ms,gpu_p95_ms,gpu_min_ms,gpu_max_ms,gpu_stddev_ms,"
+              "stat_samples,vertex_invocations,fragment_invocations,compute_invocations,"
+              "clipping_input_prims,clipping_output_prims,ns_per_fragment,ns_per_compute_invocation\n";
+        for (const auto& r : records) {
+            os << csvField(r.path) << ',' << r.kind << ',' << r.status << ','
+               << (r.timings.binaryCacheHit ? 1 : 0) << ','
+               << r.timings.preprocessMs << ',' << r.timings.compileMs << ','
+               << r.timings.linkMs << ',' << r.firstFrameMs << ','
+               << r.gpu.count << ',' << r.gpu.mean << ',' << r.gpu.median << ','
+               << r.gpu.p95 << ',' << r.gpu.min << ',' << r.gpu.max << ',' << r.gpu.stddev << ','
+               << r.stats.samples << ',' << r.stats.vertexInvocations << ','
+               << r.stats.fragmentInvocations << ',' << r.stats.computeInvocations << ','
+               << r.stats.clippingInputPrimitives << ',' << r.stats.clippingOutputPrimitives << ','
+               << nsPerInvocation(r.stats.gpuMs, r.stats.fragmentInvocations) << ','
+               << nsPerInvocation(r.stats.gpuMs, r.stats.computeInvocations) << '\n';
+        }
+    }
+
+    static void writeBatchJson(std::ostream& os, const std::vector<BatchRecord>& records,
+                               int width, int height, int frames) {
+        os << "{\n"
+           << "  \"renderer\": " << JsonString(glString(GL_RENDERER)) << ",\n"
+           << "  \"version\": " << JsonString(glString(GL_VERSION)) << ",\n"
+           << "  \"width\": " << width << ",\n"
+           << "  \"height\": " << height << ",\n"
+           << "  \"frames\": " << frames << ",\n"
+           << "  \"shaders\": [\n";
+
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            const BatchRecord& r = records[i];
+            os << "    {\n"
+               << "      \"path\": " << JsonString(r.path) << ",\n"
+               << "      \"kind\": \"" << r.kind << "\",\n"
+               << "      \"status\": \"" << r.status << "\",\n"
+               << "      \"binaryCacheHit\": " << (r.timings.binaryCacheHit ? "true" : "false") << ",\n"
+               << "      \"preprocessMs\": " << r.timings.preprocessMs << ",\n"
+               << "      \"compileMs\": " << r.timings.compileMs << ",\n"
+               << "      \"linkMs\": " << r.timings.linkMs << ",\n"
+               << "      \"firstFrameMs\": " << r.firstFrameMs << ",\n"
+               << "      \"gpuMs\": { \"samples\": " << r.gpu.count
+               << ", \"mean\": " << r.gpu.mean
+               << ", \"median\": " << r.gpu.median
+               << ", \"p95\": " << r.gpu.p95
+               << ", \"min\": " << r.gpu.min
+               << ", \"max\": " << r.gpu.max
+               << ", \"stddev\": " << r.gpu.stddev << " },\n"
+               << "      \"pipelineStats\": { \"samples\": " << r.stats.samples
+               << ", \"vertexInvocations\": " << r.stats.vertexInvocations
+               << ", \"fragmentInvocations\": " << r.stats.fragmentInvocations
+               << ", \"computeInvocations\": " << r.stats.computeInvocations
+               << ", \"clippingInputPrimitives\": " << r.stats.clippingInputPrimitives
+               << ", \"clippingOutputPrimitives\": " << r.stats.clippingOutputPrimitives
+               << ", \"nsPerFragment\": " << nsPerInvocation(r.stats.gpuMs, r.stats.fragmentInvocations)
+               << ", \"nsPerComputeInvocation\": " << nsPerInvocation(r.stats.gpuMs, r.stats.computeInvocations)
+               << " }\n"
+               << "    }" << (i + 1 < records.size() ? "," : "") << "\n";
+        }
+        os << "  ]\n}\n";
+    }
+
 } // AutoGL::detail
 
 
@@ -427,9 +609,23 @@ namespace AutoGL {
     EngineGLBackend::EngineGLBackend() = default;
 
     EngineGLBackend::~EngineGLBackend() {
-        if (currentProgram_ != 0) {
-            glDeleteProgram(currentProgram_);
-            currentProgram_ = 0;
+        // 워커 컨텍스트를 먼저 정리해야 공유 중인 렌더 컨텍스트를 안전하게 파괴할 수 있음
+        compiler_.shutdown();
+
+        releaseStages(mainSlot_.stages);
+        mainSlot_.stages = {};
+        mainSlot_.instances.release();
+        heatmap_.release();
+        profiler_.release();
+        destroyTiles();
+        for (auto& [path, mesh] : meshes_) mesh.release();
+        meshes_.clear();
+        dropVariantCache();
+        stageCache_.clear();
+
+        if (mainSlot_.pipeline) {
+            glDeleteProgramPipelines(1, &mainSlot_.pipeline);
+            mainSlot_.pipeline = 0;
         }
         if (state_.quadVBO) {
             glDeleteBuffers(1, &state_.quadVBO);
@@ -440,13 +636,16 @@ namespace AutoGL {
             state_.quadVAO = 0;
         }
         if (state_.window) {
+            if (debugMode_ != GLDebugMode::Off) {
+                GL::LogDebugSummary();
+            }
             glfwDestroyWindow(state_.window);
             state_.window = nullptr;
             glfwTerminate();
         }
     }
 
-    bool EngineGLBackend::initContext() {
+    bool EngineGLBackend::initContext(bool visible) {
         if (!glfwInit()) {
             AUTOGL_LOG_FATAL("EngineGL", "GLFW init failed");
             return false;
@@ -456,6 +655,15 @@ namespace AutoGL {
         glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
+        // release 모드는 KHR_no_error 컨텍스트로 드라이버 검증까지 생략
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT,
+            debugMode_ != GLDebugMode::Off ? GLFW_TRUE : GLFW_FALSE);
+        glfwWindowHint(GLFW_CONTEXT_NO_ERROR,
+            debugMode_ == GLDebugMode::Off ? GLFW_TRUE : GLFW_FALSE);
+
+        // 썸네일 생성처럼 화면이 필요 없는 작업은 숨김 창 사용
+        glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+
         state_.window = glfwCreateWindow(
             state_.width, state_.height, "AutoGL Engine", nullptr, nullptr);
         if (!state_.window) {
@@ -469,13 +677,38 @@ namespace AutoGL {
 
         glfwSetCursorPosCallback(state_.window, AutoGL::detail::cursor_pos_callback);
         glfwSetMouseButtonCallback(state_.window, AutoGL::detail::mouse_button_callback);
+        glfwSetFramebufferSizeCallback(state_.window, AutoGL::detail::framebuffer_size_callback);
+        glfwSetWindowRefreshCallback(state_.window, AutoGL::detail::window_refresh_callback);
+        glfwSetWindowIconifyCallback(state_.window, AutoGL::detail::window_iconify_callback);
+        glfwSetWindowFocusCallback(state_.window, AutoGL::detail::window_focus_callback);
+        glfwSetKeyCallback(state_.window, AutoGL::detail::key_callback);
+
+        // 초기 입력 스냅샷 (이후에는 콜백이 갱신)
+        InputSnapshot& in = state_.eventInput;
+        glfwGetFramebufferSize(state_.window, &in.fbWidth, &in.fbHeight);
+        in.focused = glfwGetWindowAttrib(state_.window, GLFW_FOCUSED) != 0;
+        in.hidden  = !visible;
+        detail::publishInput(state_);
+        detail::syncInput(state_);
 
         if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
             AUTOGL_LOG_FATAL("EngineGL", "GLAD load failed");
             return false;
         }
 
+        GL::InstallDebugOutput(debugMode_);
+
         detail::createFullscreenQuad(state_);
+        glCreateProgramPipelines(1, &mainSlot_.pipeline);
+        state_.glState.invalidate();
+
+        GL::EnableParallelShaderCompile();
+
+        // 대기 중인 렌더 스레드를 다른 스레드에서 깨움
+        watcher_.setOnChange([this] { state_.wake.notify(); });
+        compiler_.setOnComplete([this] { state_.wake.notify(); });
+        compiler_.setWarmUpGraphics(true);
+        compiler_.init(state_.window);
 
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 
@@ -490,6 +723,34 @@ namespace AutoGL {
         return initContext();
     }
 
+    void EngineGLBackend::setDebugMode(GLDebugMode mode) {
+        debugMode_ = mode;
+
+        // 컨텍스트가 이미 있으면 콜백 설정만 바꿈 (컨텍스트 플래그는 그대로)
+        if (state_.window) {
+            GL::InstallDebugOutput(debugMode_);
+        }
+    }
+
+    void EngineGLBackend::setProgramCacheDir(const std::string& dir) {
+        SetProgramCacheDirectory(dir);
+    }
+
+    void EngineGLBackend::setShaderVariant(const std::string& name, const std::string& value) {
+        {
+            std::lock_guard<std::mutex> lock(variantMutex_);
+            if (value.empty()) requestedVariant_.erase(name);
+            else               requestedVariant_[name] = value;
+        }
+        variantDirty_.store(true, std::memory_order_release);
+        state_.wake.notify();
+    }
+
+    void EngineGLBackend::setOnDemandRendering(bool enabled) {
+        onDemand_.store(enabled, std::memory_order_release);
+        state_.wake.notify();
+    }
+
     void EngineGLBackend::setWindowSize(int w, int h) {
         state_.width  = w;
         state_.height = h;
@@ -499,165 +760,1820 @@ namespace AutoGL {
         }
     }
 
-    unsigned int EngineGLBackend::tryLoadProgram(const std::string& path) {
-        LoadedShaderProgram ls = loadShaderProgram(path);
-        if (ls.program == 0) {
+    GraphicsStages EngineGLBackend::tryLoadProgram(const std::string& path) {
+        LoadedShaderProgram ls = loadShaderProgram(path, &preprocessor_, &variantSelection_, &stageCache_);
+        watchSources(ls.sourceFiles);
+        if (ls.sourceHash != 0) requestedSourceHash_ = ls.sourceHash;
+        if (!ls.stages.valid()) {
             AUTOGL_LOG_ERROR("EngineGL", "shader compile failed, keep old program");
-            return 0;  
+            releaseShaderProgram(ls, &stageCache_);
+            return {};
         } 
-        return ls.program;
+        storeVariant(ls);
+        setSlotGeometry(mainSlot_, ls);
+        return ls.stages;
     }
 
-    void EngineGLBackend::swapProgram(unsigned int newProgram) {
-        if (!newProgram) return;
+    void EngineGLBackend::swapProgram(PipelineSlot& slot, const GraphicsStages& stages) {
+        if (!stages.valid() || stages == slot.stages) return;
 
-        if (currentProgram_ != 0) {
-            glDeleteProgram(currentProgram_);
+        // 바뀐 stage만 pipeline에서 교체 (공유 vertex stage는 그대로 유지)
+        if (stages.vertex != slot.stages.vertex) {
+            glUseProgramStages(slot.pipeline, GL_VERTEX_SHADER_BIT, stages.vertex);
+            slot.vertexLocs = detail::QueryBuiltinUniforms(stages.vertex);
         }
-        currentProgram_ = newProgram;
-        glUseProgram(currentProgram_);
-
-        GLenum err;
-        while ((err = glGetError()) != GL_NO_ERROR) {
-            AUTOGL_LOG_ERROR("EngineGL",
-                "GL error after using new program code " + std::to_string(err));
+        if (stages.fragment != slot.stages.fragment) {
+            glUseProgramStages(slot.pipeline, GL_FRAGMENT_SHADER_BIT, stages.fragment);
+            slot.fragmentLocs = detail::QueryBuiltinUniforms(stages.fragment);
+        }
+        // compute stage도 같은 pipeline에 두면 dispatch 전에 프로그램을 바꿀 필요가 없음
+        if (stages.compute != slot.stages.compute) {
+            glUseProgramStages(slot.pipeline, GL_COMPUTE_SHADER_BIT, stages.compute);
+            slot.computeLocs = detail::QueryBuiltinUniforms(stages.compute);
         }
+
+        stageCache_.retain(stages.vertex);
+        stageCache_.retain(stages.fragment);
+        stageCache_.retain(stages.compute);
+        releaseStages(slot.stages);
+        slot.stages = stages;
+        state_.redrawRequested = true;
     }
 
-    bool EngineGLBackend::runShaderFile(const std::string& path) {
-        LoadedShaderProgram ls = loadShaderProgram(path);
-        GLuint program = ls.program;
+    void EngineGLBackend::releaseStages(const GraphicsStages& stages) {
+        stageCache_.release(stages.vertex);
+        stageCache_.release(stages.fragment);
+        stageCache_.release(stages.compute);
+    }
 
-        if (program == 0)
-            return false;
+    void EngineGLBackend::uploadSlotUniforms(const PipelineSlot& slot,
+                                             const BuiltinUniformValues& values) {
+        detail::uploadBuiltinUniforms(slot.stages.vertex,   slot.vertexLocs,   values);
+        detail::uploadBuiltinUniforms(slot.stages.fragment, slot.fragmentLocs, values);
+        detail::uploadBuiltinUniforms(slot.stages.compute,  slot.computeLocs,  values);
+    }
 
-        isComputeMode_ = AutoGL::detail::hasComputeStage(program);
-        glUseProgram(program);
+    // @instances/@mesh/@indirect만 바뀐 reload는 stage가 그대로라 swapProgram이 아무것도 안 하므로 따로 반영
+    // (// @profile 구간 목록도 같이)
+    void EngineGLBackend::setSlotGeometry(PipelineSlot& slot, const LoadedShaderProgram& ls) {
+        if (slot.instanceCount == ls.instanceCount && slot.meshPath == ls.meshPath &&
+            slot.indirect == ls.indirect && slot.profileRegions == ls.profileRegions) {
+            return;
+        }
+        slot.instanceCount  = ls.instanceCount;
+        slot.meshPath       = ls.meshPath;
+        slot.indirect       = ls.indirect;
+        slot.profileRegions = ls.profileRegions;
+        state_.redrawRequested = true;
+    }
 
-        const bool isCompute = AutoGL::detail::hasComputeStage(program);
+    void EngineGLBackend::drawSlot(PipelineSlot& slot, int instanceCount) {
+        drawProgram(slot.instances, slot.stages, slot.computeLocs, slot.indirect,
+                    slot.meshPath, instanceCount);
+    }
 
-        state_.startTime     = glfwGetTime();
-        state_.prevFrameTime = state_.startTime;
-        state_.frameCount    = 0;
+    // pipeline이 바인딩된 상태에서 호출: compute stage가 있으면 먼저 dispatch하고
+    // SSBO를 연결한 뒤 quad/메시를 instanced 또는 indirect로 draw
+    void EngineGLBackend::drawProgram(GL::InstanceBuffers& instances, const GraphicsStages& stages,
+                                      const BuiltinUniformLocations& computeLocs,
+                                      const IndirectDrawInfo& indirect, const std::string& meshPath,
+                                      int instanceCount) {
+        // 크기 미정 SSBO 배열은 인스턴스 수와 indirect 명령 수 중 큰 쪽에 맞춤
+        const int elements = std::max(instanceCount, indirect.enabled() ? indirect.maxDraws : 0);
+        instances.prepare(stages, elements);
+
+        GLuint commands = 0;
+        if (indirect.enabled()) {
+            const auto binding = static_cast<GLuint>(indirect.binding);
+            instances.reserve(binding, GL::kIndirectCommandOffset +
+                                       GL::kIndirectMaxCommandSize * indirect.maxDraws);
+            commands = instances.buffer(binding);
+        }
+        instances.bind();
 
-        // ========================================================
-        // Compute 전용 모드
-        // ========================================================
-        if (isCompute) {
-            AutoGL::detail::setBuiltinUniforms(program, state_);
+        const GL::MeshBuffers* mesh = acquireMesh(meshPath);
+        if (stages.compute) {
+            if (computeLocs.iMeshIndexCount >= 0) {
+                glProgramUniform1i(stages.compute, computeLocs.iMeshIndexCount,
+                                   mesh ? mesh->indexCount() : 6);
+            }
+            // compute 없이 @indirect만 쓰면 명령 개수도 setInstanceData로 올린 값 그대로
+            if (commands) GL::ResetIndirectCommands(commands, indirect.maxDraws);
+            GL::DispatchStageCompute(stages.compute, elements);
+        }
 
-            double t0 = glfwGetTime();
-            bool ok   = AutoGL::detail::SafeDispatchCompute(program, 1, 1, 1);
-            double t1 = glfwGetTime();
+        drawGeometry(mesh, instanceCount, commands, indirect.maxDraws);
+    }
 
-            if (!ok || (t1 - t0) > 0.5) {
-                AUTOGL_LOG_FATAL("Compute",
-                    "Compute dispatch failed or took too long.");
-                glDeleteProgram(program);
-                return false;
+    // 처음 쓰일 때 렌더 스레드에서 로드 (파싱은 로더 안에서 여러 스레드로 나눠짐)
+    const GL::MeshBuffers* EngineGLBackend::acquireMesh(const std::string& path) {
+        if (path.empty()) return nullptr;
+
+        auto it = meshes_.find(path);
+        if (it == meshes_.end()) {
+            it = meshes_.try_emplace(path).first;
+
+            MeshData data;
+            if (LoadMesh(path, data) && !it->second.create(data)) {
+                AUTOGL_LOG_ERROR("EngineGL", "mesh upload failed: " + path);
             }
+        }
+        return it->second.valid() ? &it->second : nullptr;
+    }
 
-            // 새로운 타입 기반 SSBO 덤프
-            AutoGL::detail::DumpAllSSBOs(ls.bindingTypeInfo);
+    // 감시 중인 메시 파일이 바뀌면 캐시를 버림 (다음 draw에서 다시 로드), 메시였으면 true
+    bool EngineGLBackend::dropChangedMesh(const std::string& path) {
+        auto it = meshes_.find(path);
+        if (it == meshes_.end()) return false;
 
-            glDeleteProgram(program);
-            return true;
+        AUTOGL_LOG_INFO("EngineGL", "mesh changed, reloading " + path);
+        state_.glState.forgetVertexArray(it->second.vao());
+        it->second.release();
+        meshes_.erase(it);
+        state_.redrawRequested = true;
+        return true;
+    }
+
+    // 메시는 depth test를 켜고 그림 (quad는 depth를 쓰지 않음).
+    // 호출하는 쪽이 color만 지우므로 depth는 여기서 지움.
+    // commands가 있으면 draw 수를 CPU가 모르므로 명령 개수와 무관하게 draw 호출 하나
+    void EngineGLBackend::drawGeometry(const GL::MeshBuffers* mesh, int instanceCount,
+                                       GLuint commands, int maxDraws) {
+        if (!mesh) {
+            state_.glState.bindVertexArray(state_.quadVAO);
+            if (commands) GL::MultiDrawIndirect(commands, maxDraws, false);
+            else          GL::DrawQuad(instanceCount);
+            return;
         }
 
-        // ========================================================
-        // Graphics 모드
-        // ========================================================
+        state_.glState.bindVertexArray(mesh->vao());
+        glClear(GL_DEPTH_BUFFER_BIT);
+        glEnable(GL_DEPTH_TEST);
+        if (commands) mesh->drawIndirect(commands, maxDraws);
+        else          mesh->draw(instanceCount);
+        glDisable(GL_DEPTH_TEST);
+    }
+
+    int EngineGLBackend::mainInstanceCount() const {
+        const int count = instanceOverride_.load(std::memory_order_relaxed);
+        return count > 0 ? count : mainSlot_.instanceCount;
+    }
+
+    void EngineGLBackend::setCommandCapture(const std::string& path, int frames) {
+        if (path.empty()) return;
         {
-            int w, h;
-            glfwGetFramebufferSize(state_.window, &w, &h);
-            glViewport(0, 0, w, h);
+            std::lock_guard<std::mutex> lock(captureMutex_);
+            capturePath_   = path;
+            captureFrames_ = std::max(frames, 1);
+        }
+        state_.wake.notify();
+    }
 
-            glClear(GL_COLOR_BUFFER_BIT);
-            glBindVertexArray(state_.quadVAO);
-            glDrawArrays(GL_TRIANGLES, 0, 6);
-            glfwSwapBuffers(state_.window);
+    // 렌더 스레드, draw 직전: 요청된 캡처가 있으면 이 프레임부터 기록
+    void EngineGLBackend::beginRequestedCapture() {
+        std::string path;
+        int frames = 0;
+        {
+            std::lock_guard<std::mutex> lock(captureMutex_);
+            if (capturePath_.empty() || capture_.active()) return;
+            path.swap(capturePath_);
+            frames = captureFrames_;
+        }
+        capture_.begin(path, frames, state_.fbWidth, state_.fbHeight);
+    }
 
-            glDeleteProgram(program);
-            return true;
+    void EngineGLBackend::setInstanceCount(int count) {
+        instanceOverride_.store(std::max(count, 0), std::memory_order_relaxed);
+        instancesDirty_.store(true, std::memory_order_release);
+        state_.wake.notify();
+    }
+
+    void EngineGLBackend::setInstanceData(int binding, const void* data, std::size_t bytes) {
+        if (binding < 0 || !data || bytes == 0) return;
+
+        const auto* p = static_cast<const unsigned char*>(data);
+        {
+            std::lock_guard<std::mutex> lock(instanceMutex_);
+            instanceUploads_.emplace_back(binding, std::vector<unsigned char>(p, p + bytes));
         }
+        instancesDirty_.store(true, std::memory_order_release);
+        state_.wake.notify();
     }
 
+    // 렌더 스레드: 쌓인 인스턴스 요청을 main slot에 반영, 화면이 바뀌면 true
+    bool EngineGLBackend::applyInstanceRequests() {
+        if (!instancesDirty_.exchange(false, std::memory_order_acquire)) return false;
 
-    void EngineGLBackend::mainLoop(const std::string& shaderPath) {
-        // 먼저 파일을 읽어서 어떤 타입인지 판단
-        std::string fullSource = loadFileSource(shaderPath);
-        ShaderSourceSet sections = ExtractShaderSections(fullSource);
+        std::vector<std::pair<int, std::vector<unsigned char>>> uploads;
+        {
+            std::lock_guard<std::mutex> lock(instanceMutex_);
+            uploads.swap(instanceUploads_);
+        }
+        for (const auto& [binding, bytes] : uploads) {
+            mainSlot_.instances.upload(static_cast<GLuint>(binding), bytes.data(), bytes.size());
+        }
+        return true;
+    }
 
-        bool hasCompute = !sections.compute.empty();
-        bool hasVert    = !sections.vertex.empty();
-        bool hasFrag    = !sections.fragment.empty();
+    void EngineGLBackend::storeVariant(const LoadedShaderProgram& ls) {
+        variantDecls_ = ls.variants;
 
-        // compute + vertex/fragment 섞이면 금지 (로더와 일관성)
-        if (hasCompute && (hasVert || hasFrag)) {
-            AUTOGL_LOG_ERROR(
-                "EngineGL",
-                "@type compute cannot be mixed with vertex/fragment in the same file"
-            );
-            return;
+        // 같은 키의 이전 결과는 참조만 내려놓음 (화면에 쓰이는 중이면 mainSlot_이 참조 유지)
+        GraphicsStages& slot = variantPrograms_[ls.variantKey];
+        releaseStages(slot);
+        slot = ls.stages;
+        evictSpecializedVariants(ls.variantKey);
+    }
+
+    // 특수화 키는 uniform 값마다 새로 생기므로 일반 키마다 keep 하나만 남기고 나머지를 내려놓음.
+    // 일반 프로그램 항목은 그대로 두고, 화면에 쓰이는 중인 stage는 mainSlot_이 참조를 유지
+    void EngineGLBackend::evictSpecializedVariants(const std::string& keep) {
+        const std::string base = StripUniformConstants(keep);
+        for (auto it = variantPrograms_.begin(); it != variantPrograms_.end();) {
+            if (it->first != keep && it->first != base && StripUniformConstants(it->first) == base) {
+                AUTOGL_LOG_DEBUG("EngineGL", "dropped specialized variant " + it->first);
+                releaseStages(it->second);
+                it = variantPrograms_.erase(it);
+            } else {
+                ++it;
+            }
         }
+    }
 
-        // ===== CASE 1: compute-only 파일이면, runShaderFile 한 번 실행 후 종료 =====
-        if (hasCompute) {
-            AUTOGL_LOG_INFO("EngineGL",
-                "Compute-only shader: single dispatch then exit");
-            runShaderFile(shaderPath);
-            return;
+    void EngineGLBackend::dropVariantCache() {
+        for (const auto& [key, stages] : variantPrograms_) {
+            releaseStages(stages);
         }
+        variantPrograms_.clear();
+    }
+
+    bool EngineGLBackend::takeRequestedVariant() {
+        if (!variantDirty_.exchange(false, std::memory_order_acquire)) return false;
 
-        // ===== CASE 2: 그래픽 전용 파일 (vertex/fragment만 있는 경우) =====
-        fs::file_time_type lastTime = fs::last_write_time(shaderPath);
+        std::lock_guard<std::mutex> lock(variantMutex_);
+        if (requestedVariant_ == variantSelection_) return false;
+        variantSelection_ = requestedVariant_;
+        return true;
+    }
 
-        GLuint initial = tryLoadProgram(shaderPath);
-        swapProgram(initial);
+    void EngineGLBackend::switchVariant(const std::string& path) {
+        const std::string key = MakeVariantKey(variantDecls_, variantSelection_);
 
-        state_.startTime     = glfwGetTime();
-        state_.prevFrameTime = state_.startTime;
-        state_.frameCount    = 0;
+        // 일반 프로그램으로 돌아가거나 다른 값으로 다시 특수화하면 이전 특수화는 버림
+        evictSpecializedVariants(key);
 
-        while (!glfwWindowShouldClose(state_.window)) {
-            // hot reload
-            auto now = fs::last_write_time(shaderPath);
-            if (now != lastTime) {
-                lastTime = now;
-                AUTOGL_LOG_INFO("EngineGL", "shader changed, recompiling");
-
-                GLuint np = tryLoadProgram(shaderPath);
-                if (np != 0) {
-                    swapProgram(np);
+        auto it = variantPrograms_.find(key);
+        if (it != variantPrograms_.end()) {
+            AUTOGL_LOG_DEBUG("EngineGL", "variant " + key + " (cached)");
+            swapProgram(mainSlot_, it->second);
+            return;
+        }
+
+        // 처음 쓰는 조합만 빌드, 그동안은 이전 variant로 계속 그림
+        AUTOGL_LOG_INFO("EngineGL", "compiling variant " + key);
+        resetTimeOnSwap_ = false;
+        requestReload(path);
+    }
+
+    void EngineGLBackend::requestReload(const std::string& path) {
+        if (!compiler_.available()) {
+            // 공유 컨텍스트가 없으면 렌더 스레드에서 바로 컴파일
+            GraphicsStages np = tryLoadProgram(path);
+            if (np.valid()) {
+                swapProgram(mainSlot_, np);
+                if (resetTimeOnSwap_) {
                     state_.startTime     = glfwGetTime();
                     state_.prevFrameTime = state_.startTime;
                     state_.frameCount    = 0;
                 }
             }
+            return;
+        }
 
-            glClear(GL_COLOR_BUFFER_BIT);
+        submitBuild(path);
+    }
+
+    void EngineGLBackend::submitBuild(const std::string& path) {
+        compiler_.submit(path, [this, path, selection = variantSelection_] {
+            return loadShaderProgram(path, &preprocessor_, &selection, &stageCache_);
+        });
+    }
+
+    void EngineGLBackend::collectCompiledPrograms() {
+        AsyncShaderCompiler::Result r;
+        while (compiler_.poll(r)) {
+            // 새로 추가된 include도 감시 (실패한 빌드라도 고치면 다시 잡히도록)
+            watchSources(r.program.sourceFiles);
 
-            if (currentProgram_ != 0) {
-                glUseProgram(currentProgram_);
-                detail::setBuiltinUniforms(currentProgram_, state_);
+            if (!r.program.stages.valid()) {
+                AUTOGL_LOG_ERROR("EngineGL", "shader compile failed, keep old program");
+                releaseShaderProgram(r.program, &stageCache_);
+                continue;
+            }
 
-                int w, h;
-                glfwGetFramebufferSize(state_.window, &w, &h);
-                glViewport(0, 0, w, h);
+            storeVariant(r.program);
+            setSlotGeometry(mainSlot_, r.program);
 
-                glBindVertexArray(state_.quadVAO);
-                glDrawArrays(GL_TRIANGLES, 0, 6);
+            // 컴파일 도중 다른 variant로 바뀌었으면 캐시에만 넣어 둠
+            if (r.program.variantKey != MakeVariantKey(variantDecls_, variantSelection_)) {
+                continue;
             }
 
-            glfwSwapBuffers(state_.window);
-            glfwPollEvents();
+            swapProgram(mainSlot_, r.program.stages);
+            if (resetTimeOnSwap_) {
+                state_.startTime     = glfwGetTime();
+                state_.prevFrameTime = state_.startTime;
+                state_.frameCount    = 0;
+            }
+        }
+    }
+
+    bool EngineGLBackend::shouldDraw(bool animated, bool usesMouse) const {
+        if (!onDemand_.load(std::memory_order_acquire)) return true;
+        if (state_.hidden) return false;
+        return animated || state_.redrawRequested || (usesMouse && state_.inputChanged);
+    }
+
+    void EngineGLBackend::finishFrameDraw(double inputTime) {
+        glfwSwapBuffers(state_.window);
+        state_.redrawRequested = false;
+        state_.inputChanged    = false;
+
+        // frames-in-flight 제한 + 입력 지연 측정 (둘 다 꺼져 있으면 아무것도 안 함)
+        pacer_.endFrame(inputTime);
+        std::vector<double> samples;
+        pacer_.collect(samples);
+        if (!samples.empty()) {
+            std::lock_guard<std::mutex> lock(latencyMutex_);
+            for (double ms : samples) {
+                if (latencyMs_.size() >= kLatencyWindow) latencyMs_.pop_front();
+                latencyMs_.push_back(ms);
+            }
+        }
 
-            GLenum err;
-            while ((err = glGetError()) != GL_NO_ERROR) {
-                AUTOGL_LOG_ERROR("EngineGL",
-                    "GL error in mainLoop code " + std::to_string(err));
+        // draw 구간을 감싼 통계/타이머 결과 (감싸지 않은 프레임이면 비어 있음)
+        std::vector<GL::PipelineStats> stats;
+        std::vector<double> gpuMs;
+        frameStats_.collect(stats);
+        frameTimer_.collect(gpuMs);
+        if (!stats.empty() || !gpuMs.empty()) {
+            std::lock_guard<std::mutex> lock(statsMutex_);
+            for (const GL::PipelineStats& s : stats) {
+                if (statsSamples_.size() >= kStatsWindow) statsSamples_.pop_front();
+                statsSamples_.push_back(s);
             }
+            for (double ms : gpuMs) {
+                if (statsGpuMs_.size() >= kStatsWindow) statsGpuMs_.pop_front();
+                statsGpuMs_.push_back(ms);
+            }
+        }
+    }
+
+    // draw 직전 (렌더 스레드): 프레임 시작 이후 들어온 입력까지 반영해서
+    // iMouse를 매핑된 버퍼에 씀. 반환한 스냅샷의 serial/시각은 지연 측정에 사용
+    InputSnapshot EngineGLBackend::latchInput() {
+        const InputSnapshot in = state_.input.load();
+
+        float mouse[4];
+        detail::packMouse(in.mouseX, in.mouseY, in.mouseDown, in.clickX, in.clickY, mouse);
+        latchBuffer_.write(mouse);
+        return in;
+    }
+
+    void EngineGLBackend::setLateLatchInput(bool enabled) {
+        lateLatch_ = enabled;
+    }
+
+    void EngineGLBackend::setOverdrawHeatmap(bool enabled) {
+        overdrawHeatmap_.store(enabled, std::memory_order_release);
+        state_.wake.notify();
+    }
+
+    // 렌더 스레드: 켜고 끄는 것은 variant 전환과 같은 경로 (처음 한 번만 계측된 프로그램을 빌드)
+    void EngineGLBackend::applyOverdrawRequest() {
+        if (state_.heatmapToggled) {
+            state_.heatmapToggled = false;
+            overdrawHeatmap_.store(!overdrawHeatmap_.load(std::memory_order_acquire),
+                                   std::memory_order_release);
+        }
+
+        const bool want = overdrawHeatmap_.load(std::memory_order_acquire);
+        if (want == overdrawApplied_) return;
+        overdrawApplied_ = want;
+        state_.redrawRequested = true;
+
+        setShaderVariant(kOverdrawDefine, want ? "1" : "");
+        AUTOGL_LOG_INFO("EngineGL", want
+            ? "overdraw heatmap on (1 = blue ... " + std::to_string(GL::OverdrawHeatmap::kSaturation) + "+ = red)"
+            : std::string("overdraw heatmap off"));
+    }
+
+    void EngineGLBackend::setUniform(const std::string& name, const std::vector<float>& value) {
+        {
+            std::lock_guard<std::mutex> lock(uniformMutex_);
+            requestedUniforms_[name] = value;
         }
+        state_.wake.notify();
+    }
+
+    void EngineGLBackend::setUniformSpecialization(bool enabled, int stableFrames) {
+        specializeFrames_.store(std::max(stableFrames, 1), std::memory_order_relaxed);
+        specializeUniforms_.store(enabled, std::memory_order_release);
+        state_.wake.notify();
+    }
+
+    // 렌더 스레드, variant 반영 전: 새 값을 받고, 특수화된 uniform의 값이 바뀌었으면 특수화 항목을 빼서
+    // 같은 루프에서 (캐시된) 일반 프로그램으로 돌아감. 값이 바뀌었으면 true
+    bool EngineGLBackend::applyUniformRequests() {
+        std::map<std::string, std::vector<float>> pending;
+        {
+            std::lock_guard<std::mutex> lock(uniformMutex_);
+            pending.swap(requestedUniforms_);
+        }
+
+        bool changed = false;
+        for (const auto& [name, value] : pending) {
+            changed = userUniforms_.set(name, value) || changed;
+        }
+
+        const bool specialize = specializeUniforms_.load(std::memory_order_acquire);
+        for (auto& [name, e] : userUniforms_.entries()) {
+            if (!e.specialized || (specialize && e.stableFrames > 0)) continue;
+            e.specialized = false;
+            setShaderVariant(kUniformConstPrefix + name, "");
+            AUTOGL_LOG_DEBUG("EngineGL", "uniform " + name + " changed, back to the generic program");
+        }
+        return changed;
+    }
+
+    // 렌더 스레드, 그린 프레임 끝: 정해진 프레임 수 동안 그대로인 uniform을 모아 한 번에 특수화
+    // (variant 전환과 같이 백그라운드에서 빌드하고, 그동안은 일반 프로그램으로 그림)
+    void EngineGLBackend::specializeStableUniforms() {
+        if (!specializeUniforms_.load(std::memory_order_acquire)) return;
+
+        const int threshold = specializeFrames_.load(std::memory_order_relaxed);
+        if (!userUniforms_.advanceFrame(threshold)) return;
+
+        std::string names;
+        for (auto& [name, e] : userUniforms_.entries()) {
+            if (!e.active || e.specialized || e.stableFrames < threshold) continue;
+            if (!std::all_of(e.value.begin(), e.value.end(), [](float v) { return std::isfinite(v); })) continue;
+
+            e.specialized = true;
+            setShaderVariant(kUniformConstPrefix + name, GL::UserUniforms::FormatConstant(e));
+            names += (names.empty() ? "" : ", ") + name;
+        }
+        if (!names.empty()) {
+            AUTOGL_LOG_INFO("EngineGL", "specializing stable uniforms as constants: " + names);
+        }
+    }
+
+    void EngineGLBackend::setShaderProfiling(bool enabled, int readbackInterval) {
+        profileInterval_.store(std::max(readbackInterval, 1), std::memory_order_relaxed);
+        profiling_.store(enabled, std::memory_order_release);
+        state_.wake.notify();
+    }
+
+    std::vector<ShaderProfileRegion> EngineGLBackend::shaderProfile() const {
+        std::lock_guard<std::mutex> lock(profileMutex_);
+        return profileResults_;
+    }
+
+    // 렌더 스레드: overdraw heatmap과 같이 variant 전환으로 계측된 프로그램을 빌드
+    void EngineGLBackend::applyProfilingRequest() {
+        const bool want = profiling_.load(std::memory_order_acquire);
+        if (want == profilingApplied_) return;
+
+        if (want && !GL::QueryExtensions().shaderClock) {
+            AUTOGL_LOG_WARN("EngineGL", "shader profiling needs GL_ARB_shader_clock, not enabled");
+            profiling_.store(false, std::memory_order_release);
+            return;
+        }
+        profilingApplied_ = want;
+        state_.redrawRequested = true;
+        if (!want) profiler_.release();
+
+        setShaderVariant(kProfileDefine, want ? "1" : "");
+        AUTOGL_LOG_INFO("EngineGL", want
+            ? "shader profiling on (readback every " +
+              std::to_string(profileInterval_.load(std::memory_order_relaxed)) + " frames)"
+            : std::string("shader profiling off"));
+    }
+
+    // 렌더 스레드, 계측된 draw/dispatch 뒤: readback이 끝났으면 결과를 보관하고 로그로 출력.
+    // final이면 interval과 무관하게 지금까지의 누적값을 기다려서 읽음
+    void EngineGLBackend::collectProfile(bool final) {
+        if (!profiler_.active()) return;
+
+        bool updated = false;
+        if (final) {
+            updated = profiler_.flush();
+        } else {
+            profiler_.endFrame(profileInterval_.load(std::memory_order_relaxed));
+            updated = profiler_.poll();
+        }
+        if (!updated) return;
+
+        std::vector<ShaderProfileRegion> results = profiler_.results();
+        for (const ShaderProfileRegion& r : results) {
+            std::ostringstream msg;
+            msg << std::fixed << std::setprecision(1)
+                << r.name << ": " << r.cyclesPerCall << " cycles/call, "
+                << std::setprecision(0) << r.callsPerFrame << " calls/frame, "
+                << std::setprecision(1) << r.share * 100.0 << "%";
+            AUTOGL_LOG_INFO("Profile", msg.str());
+        }
+
+        std::lock_guard<std::mutex> lock(profileMutex_);
+        profileResults_ = std::move(results);
+    }
+
+    PipelineStatistics EngineGLBackend::pipelineStatistics() const {
+        std::vector<GL::PipelineStats> stats;
+        std::vector<double> gpuMs;
+        {
+            std::lock_guard<std::mutex> lock(statsMutex_);
+            stats.assign(statsSamples_.begin(), statsSamples_.end());
+            gpuMs.assign(statsGpuMs_.begin(), statsGpuMs_.end());
+        }
+        return GL::AveragePipelineStats(stats, gpuMs);
+    }
+
+    InputLatencyStats EngineGLBackend::inputLatency() const {
+        std::vector<double> samples;
+        {
+            std::lock_guard<std::mutex> lock(latencyMutex_);
+            samples.assign(latencyMs_.begin(), latencyMs_.end());
+        }
+
+        const SampleSummary sum = Summarize(std::move(samples));
+        InputLatencyStats out;
+        out.samples  = sum.count;
+        out.meanMs   = sum.mean;
+        out.medianMs = sum.median;
+        out.p95Ms    = sum.p95;
+        out.maxMs    = sum.max;
+        return out;
+    }
+
+    // 렌더 스레드 루프 끝에서 호출: 다음 프레임을 그릴 이유가 생길 때까지 대기.
+    // 입력 콜백, 파일 변경, 컴파일 완료, variant 요청, 창 닫기는 state_.wake로 여기서 깨움
+    // (GLFW 이벤트 함수는 메인 스레드 전용이라 렌더 스레드에서는 부르지 않음)
+    void EngineGLBackend::waitForEvents(bool animated) {
+        if (!onDemand_.load(std::memory_order_acquire)) return;
+
+        // 워커 결과가 fence signal을 기다리는 중이면 깨워 줄 신호가 없으므로 짧게만 잠듦
+        constexpr double kBusyWait = 0.002;
+        // 포커스를 잃은 애니메이션 셰이더의 프레임 간격 (약 15fps)
+        constexpr double kUnfocusedInterval = 1.0 / 15.0;
+        const bool busy = compiler_.hasResults();
+
+        if (animated && !state_.hidden) {
+            if (state_.focused) return;
+
+            const double wait = state_.prevFrameTime + kUnfocusedInterval - glfwGetTime();
+            if (wait > 0.0) state_.wake.wait(busy ? std::min(wait, kBusyWait) : wait);
+            return;
+        }
+
+        if (state_.redrawRequested) return;
+
+        state_.wake.wait(busy ? kBusyWait : -1.0);
+    }
+
+    // GL 컨텍스트를 렌더 스레드로 넘겨 loop를 실행하고, 호출한 메인 스레드는 GLFW 이벤트만 처리.
+    // 입력은 콜백이 발행하는 스냅샷으로만 전달되므로 느린 프레임이 이벤트 처리를 막지 않음.
+    // loop가 끝나면 컨텍스트를 메인 스레드로 되돌림 (정리 코드가 메인 스레드에서 GL을 호출)
+    void EngineGLBackend::runOnRenderThread(const std::function<void()>& loop) {
+        std::atomic<bool> rendering{true};
+
+        glfwMakeContextCurrent(nullptr);
+        std::thread render([this, &loop, &rendering] {
+            glfwMakeContextCurrent(state_.window);
+            loop();
+            glfwMakeContextCurrent(nullptr);
+
+            rendering.store(false, std::memory_order_release);
+            glfwPostEmptyEvent();   // 이벤트를 기다리는 메인 스레드를 깨움
+        });
+
+        while (rendering.load(std::memory_order_acquire)) {
+            glfwWaitEvents();
+
+            // 입력이 없어 대기 중인 렌더 스레드가 닫기 요청을 확인하도록 깨움
+            if (glfwWindowShouldClose(state_.window)) state_.wake.notify();
+        }
+
+        render.join();
+        glfwMakeContextCurrent(state_.window);
+    }
+
+    void EngineGLBackend::watchSources(const std::vector<std::string>& files) {
+        for (const auto& f : files) {
+            watcher_.addFile(f);
+        }
+    }
+
+    bool EngineGLBackend::runShaderFile(const std::string& path) {
+        applyProfilingRequest();
+        takeRequestedVariant();
+        LoadedShaderProgram ls = loadShaderProgram(path, &preprocessor_, &variantSelection_, &stageCache_);
+        isComputeMode_ = ls.isCompute;
+
+        state_.startTime     = glfwGetTime();
+        state_.prevFrameTime = state_.startTime;
+        state_.frameCount    = 0;
+
+        // ========================================================
+        // Compute 전용 모드
+        // ========================================================
+        if (ls.isCompute) {
+            GLuint program = ls.program;
+            if (program == 0)
+                return false;
+
+            state_.glState.useProgram(program);
+            const BuiltinUniformLocations locs = detail::QueryBuiltinUniforms(program);
+            AutoGL::detail::setBuiltinUniforms(program, locs, state_);
+
+            if (profilingApplied_) {
+                profiler_.setRegions(ls.profileRegions);
+                profiler_.bind();
+            }
+
+            // 캡처 요청이 있으면 dispatch 한 번을 한 프레임으로 기록
+            beginRequestedCapture();
+
+            double t0 = glfwGetTime();
+            bool ok   = AutoGL::detail::SafeDispatchCompute(program, 1, 1, 1);
+            double t1 = glfwGetTime();
+
+            if (capture_.active()) {
+                capture_.endFrame();
+                capture_.finish();
+            }
+
+            // dispatch 한 번뿐이라 바로 기다려서 읽음
+            collectProfile(true);
+            profiler_.release();
+
+            if (!ok || (t1 - t0) > 0.5) {
+                AUTOGL_LOG_FATAL("Compute",
+                    "Compute dispatch failed or took too long.");
+                state_.glState.forgetProgram(program);
+                glDeleteProgram(program);
+                return false;
+            }
+
+            // 새로운 타입 기반 SSBO 덤프
+            AutoGL::detail::DumpAllSSBOs(ls.bindingTypeInfo);
+
+            state_.glState.forgetProgram(program);
+            glDeleteProgram(program);
+            return true;
+        }
+
+        // ========================================================
+        // Graphics 모드
+        // ========================================================
+        if (!ls.stages.valid())
+            return false;
+
+        {
+            swapProgram(mainSlot_, ls.stages);
+            setSlotGeometry(mainSlot_, ls);
+            releaseShaderProgram(ls, &stageCache_);
+            applyInstanceRequests();
+
+            state_.glState.useProgram(0);
+            state_.glState.bindProgramPipeline(mainSlot_.pipeline);
+            detail::advanceFrameState(state_);
+            uploadSlotUniforms(mainSlot_, detail::captureBuiltinValues(state_));
+
+            state_.glState.viewport(0, 0, state_.fbWidth, state_.fbHeight);
+
+            glClear(GL_COLOR_BUFFER_BIT);
+            drawSlot(mainSlot_, mainInstanceCount());
+            glfwSwapBuffers(state_.window);
+            return true;
+        }
+    }
+
+
+    void EngineGLBackend::mainLoop(const std::string& shaderPath) {
+        // 먼저 파일을 읽어서 어떤 타입인지 판단
+        ShaderPreprocessor::Result pre = preprocessor_.preprocess(shaderPath);
+        if (!pre.ok) {
+            return;
+        }
+        ShaderSourceSet sections = ExtractShaderSections(pre.source);
+
+        bool hasCompute = !sections.compute.empty();
+        bool hasVert    = !sections.vertex.empty();
+        bool hasFrag    = !sections.fragment.empty();
+
+        // ===== CASE 1: compute-only 파일이면, runShaderFile 한 번 실행 후 종료 =====
+        // (vertex/fragment와 같이 있는 compute는 그래픽 stage로 매 프레임 dispatch)
+        if (hasCompute && !hasVert && !hasFrag) {
+            AUTOGL_LOG_INFO("EngineGL",
+                "Compute-only shader: single dispatch then exit");
+            runShaderFile(shaderPath);
+            return;
+        }
+
+        // ===== CASE 2: 그래픽 파일 (compute stage가 같이 있을 수 있음) =====
+        // 파일 감시는 별도 스레드가 담당, 루프에서는 atomic 플래그만 확인
+        // (include된 파일은 로드할 때 watchSources로 추가됨)
+        const std::string rootPath = ShaderPreprocessor::normalizePath(shaderPath);
+        watchSources(pre.files);
+        watcher_.start();
+
+        runOnRenderThread([this, &shaderPath, &rootPath] { renderMainLoop(shaderPath, rootPath); });
+    }
+
+    void EngineGLBackend::renderMainLoop(const std::string& shaderPath, const std::string& rootPath) {
+        // late-latch: iMouse를 uniform block으로 빌드하고 draw 직전에 매핑된 버퍼에 씀.
+        // GPU가 한 프레임 넘게 밀리면 늦게 쓴 의미가 없으므로 frames-in-flight를 1로 제한
+        const bool lateLatch = lateLatch_ && latchBuffer_.create();
+        SetLateLatchInput(lateLatch);
+        pacer_.setMaxFramesInFlight(lateLatch ? 1 : 0);
+        if (lateLatch) {
+            AUTOGL_LOG_INFO("EngineGL", "late-latch input enabled (1 frame in flight)");
+        }
+        std::uint32_t measuredSerial = state_.seenInputSerial;
+
+        applyProfilingRequest();
+        applyUniformRequests();
+        takeRequestedVariant();
+        swapProgram(mainSlot_, tryLoadProgram(shaderPath));
+
+        state_.startTime     = glfwGetTime();
+        state_.prevFrameTime = state_.startTime;
+        state_.frameCount    = 0;
+
+        while (!glfwWindowShouldClose(state_.window)) {
+            detail::syncInput(state_);
+
+            // hot reload: 컴파일은 워커에서, 교체는 링크가 끝난 뒤 프레임 경계에서
+            if (watcher_.hasChanges()) {
+                // 바뀐 파일의 캐시만 버리고, 그 파일을 포함하는 셰이더만 다시 빌드
+                bool affected = false;
+                for (const auto& changed : watcher_.takeChanges()) {
+                    if (dropChangedMesh(changed)) continue;
+                    for (const auto& root : preprocessor_.invalidate(changed)) {
+                        if (root == rootPath) affected = true;
+                    }
+                }
+
+                // mtime만 바뀌고 내용이 같으면 (touch, autosave) 아무것도 하지 않음
+                const std::uint64_t hash = affected ? hashShaderFile(shaderPath, &preprocessor_) : 0;
+                if (affected && hash != 0 && hash == requestedSourceHash_) {
+                    AUTOGL_LOG_DEBUG("EngineGL", "shader content unchanged, reload skipped");
+                    affected = false;
+                }
+
+                if (affected) {
+                    // 다른 variant는 소스가 바뀌었으니 버리고, 현재 것만 다시 빌드 (나머지는 쓸 때 lazy)
+                    AUTOGL_LOG_INFO("EngineGL", "shader changed, recompiling");
+                    requestedSourceHash_ = hash;
+                    dropVariantCache();
+                    resetTimeOnSwap_ = true;
+                    requestReload(shaderPath);
+                }
+            }
+
+            if (applyUniformRequests()) {
+                state_.redrawRequested = true;
+            }
+            applyOverdrawRequest();
+            applyProfilingRequest();
+            if (takeRequestedVariant()) {
+                switchVariant(shaderPath);
+            }
+
+            if (compiler_.hasResults()) {
+                collectCompiledPrograms();
+            }
+
+            if (applyInstanceRequests()) {
+                state_.redrawRequested = true;
+            }
+
+            // 시간/입력 의존성은 링크된 프로그램의 active uniform으로 판단
+            // (컴파일러가 지운 uniform은 위치가 -1).
+            // compute stage는 SSBO 상태를 한 스텝씩 진행시키므로 uniform과 무관하게 매 프레임 실행
+            const bool animated  = mainSlot_.fragmentLocs.usesTime()  || mainSlot_.vertexLocs.usesTime() ||
+                                   mainSlot_.computeLocs.usesTime()   || mainSlot_.stages.compute != 0;
+            const bool usesMouse = mainSlot_.fragmentLocs.usesMouse() || mainSlot_.vertexLocs.usesMouse() ||
+                                   mainSlot_.computeLocs.usesMouse();
+
+            // 캡처 중에는 정적 셰이더도 요청한 프레임 수를 채울 때까지 계속 그림
+            beginRequestedCapture();
+            if (capture_.active()) state_.redrawRequested = true;
+
+            if (shouldDraw(animated, usesMouse)) {
+                glClear(GL_COLOR_BUFFER_BIT);
+
+                double inputTime = state_.inputTime;
+                std::uint32_t inputSerial = state_.seenInputSerial;
+
+                if (mainSlot_.stages.valid()) {
+                    // 상태가 바뀌지 않았으면 캐시가 GL 호출을 생략
+                    state_.glState.useProgram(0);
+                    state_.glState.bindProgramPipeline(mainSlot_.pipeline);
+
+                    detail::advanceFrameState(state_);
+                    uploadSlotUniforms(mainSlot_, detail::captureBuiltinValues(state_));
+                    userUniforms_.upload(mainSlot_.stages);
+
+                    state_.glState.viewport(0, 0, state_.fbWidth, state_.fbHeight);
+                    if (lateLatch) {
+                        const InputSnapshot in = latchInput();
+                        inputTime   = in.inputTime;
+                        inputSerial = in.inputSerial;
+                    }
+                    const bool heatmap = overdrawApplied_ && heatmap_.begin(state_.fbWidth, state_.fbHeight);
+                    if (profilingApplied_) {
+                        profiler_.setRegions(mainSlot_.profileRegions);
+                        profiler_.bind();
+                    }
+                    frameTimer_.begin();
+                    frameStats_.begin();
+                    drawSlot(mainSlot_, mainInstanceCount());
+                    frameStats_.end();
+                    frameTimer_.end();
+                    if (heatmap) {
+                        state_.glState.useProgram(heatmap_.program());
+                        state_.glState.bindVertexArray(state_.quadVAO);
+                        heatmap_.drawOverlay();
+                    }
+                }
+
+                // 새 입력을 반영한 프레임만 지연 측정
+                const bool fresh = usesMouse && inputSerial != measuredSerial;
+                measuredSerial = inputSerial;
+                capture_.endFrame();
+                finishFrameDraw(fresh ? inputTime : 0.0);
+                collectProfile(false);
+                specializeStableUniforms();
+            }
+            else {
+                // iMouse를 안 쓰는 셰이더의 마우스 이동 등 화면에 영향 없는 입력은 버림
+                state_.inputChanged = false;
+            }
+
+            waitForEvents(animated || capture_.active());
+        }
+
+        const InputLatencyStats latency = inputLatency();
+        if (latency.samples > 0) {
+            std::ostringstream msg;
+            msg << std::fixed << std::setprecision(2)
+                << "input latency (" << latency.samples << " samples): median " << latency.medianMs
+                << " ms, p95 " << latency.p95Ms << " ms, max " << latency.maxMs << " ms";
+            AUTOGL_LOG_INFO("EngineGL", msg.str());
+        }
+
+        const PipelineStatistics stats = pipelineStatistics();
+        if (stats.samples > 0) {
+            AUTOGL_LOG_INFO("EngineGL", "pipeline stats (" + std::to_string(stats.samples) +
+                                        " frames): " + detail::FormatPipelineStats(stats));
+        }
+
+        capture_.finish();
+        collectProfile(true);
+        profiler_.release();
+
+        SetLateLatchInput(false);
+        latchBuffer_.release();
+        pacer_.release();
+        frameStats_.release();
+        frameTimer_.release();
+    }
+
+    // ========================================================
+    // Dashboard
+    // ========================================================
+
+    void EngineGLBackend::layoutTiles() {
+        const int n    = static_cast<int>(tiles_.size());
+        const int cols = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n)))));
+        const int rows = std::max(1, (n + cols - 1) / cols);
+        const int w    = std::max(1, state_.fbWidth  / cols);
+        const int h    = std::max(1, state_.fbHeight / rows);
+
+        if (cols == tileCols_ && w == tileWidth_ && h == tileHeight_) return;
+        tileCols_   = cols;
+        tileWidth_  = w;
+        tileHeight_ = h;
+
+        // 창 크기가 바뀔 때만 타일 텍스처/깊이 버퍼를 다시 만듦 (FBO 객체는 유지)
+        for (auto& t : tiles_) {
+            if (t.color) glDeleteTextures(1, &t.color);
+            if (t.depth) glDeleteRenderbuffers(1, &t.depth);
+            if (!t.fbo)  glCreateFramebuffers(1, &t.fbo);
+
+            glCreateTextures(GL_TEXTURE_2D, 1, &t.color);
+            glTextureStorage2D(t.color, 1, GL_RGBA8, w, h);
+            glNamedFramebufferTexture(t.fbo, GL_COLOR_ATTACHMENT0, t.color, 0);
+
+            glCreateRenderbuffers(1, &t.depth);
+            glNamedRenderbufferStorage(t.depth, GL_DEPTH_COMPONENT24, w, h);
+            glNamedFramebufferRenderbuffer(t.fbo, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, t.depth);
+        }
+    }
+
+    void EngineGLBackend::requestTileBuild(const std::string& path) {
+        if (!compiler_.available()) {
+            LoadedShaderProgram ls = loadShaderProgram(path, &preprocessor_, &variantSelection_, &stageCache_);
+            applyTileProgram(path, ls);
+            return;
+        }
+        submitBuild(path);
+    }
+
+    void EngineGLBackend::applyTileProgram(const std::string& path, LoadedShaderProgram& ls) {
+        watchSources(ls.sourceFiles);
+
+        if (!ls.stages.valid()) {
+            AUTOGL_LOG_ERROR("EngineGL", path + ": shader compile failed, keep old program");
+            releaseShaderProgram(ls, &stageCache_);
+            return;
+        }
+
+        // 같은 파일을 여러 타일에 띄운 경우 빌드 결과 하나를 같이 씀
+        for (auto& t : tiles_) {
+            if (t.path != path) continue;
+            swapProgram(t.slot, ls.stages);
+            setSlotGeometry(t.slot, ls);
+            if (t.sourceHash == 0) t.sourceHash = ls.sourceHash;
+        }
+        releaseShaderProgram(ls, &stageCache_);
+    }
+
+    void EngineGLBackend::collectTilePrograms() {
+        AsyncShaderCompiler::Result r;
+        while (compiler_.poll(r)) {
+            applyTileProgram(r.key, r.program);
+        }
+    }
+
+    void EngineGLBackend::destroyTiles() {
+        for (auto& t : tiles_) {
+            releaseStages(t.slot.stages);
+            t.slot.instances.release();
+            state_.glState.forgetProgramPipeline(t.slot.pipeline);
+            state_.glState.forgetFramebuffer(t.fbo);
+            if (t.slot.pipeline) glDeleteProgramPipelines(1, &t.slot.pipeline);
+            if (t.fbo)           glDeleteFramebuffers(1, &t.fbo);
+            if (t.color)         glDeleteTextures(1, &t.color);
+            if (t.depth)         glDeleteRenderbuffers(1, &t.depth);
+        }
+        tiles_.clear();
+        tileCols_ = tileWidth_ = tileHeight_ = 0;
+    }
+
+    void EngineGLBackend::dashboardLoop(const std::vector<std::string>& shaderPaths) {
+        runOnRenderThread([this, &shaderPaths] { renderDashboardLoop(shaderPaths); });
+    }
+
+    void EngineGLBackend::renderDashboardLoop(const std::vector<std::string>& shaderPaths) {
+        // 타일마다 iMouse 오프셋이 달라서 uniform으로만 전달
+        if (lateLatch_) {
+            AUTOGL_LOG_WARN("EngineGL", "late-latch input is not used in dashboard mode");
+        }
+
+        for (const auto& path : shaderPaths) {
+            ShaderPreprocessor::Result pre = preprocessor_.preprocess(path);
+            if (!pre.ok) continue;
+
+            ShaderSourceSet sections = ExtractShaderSections(pre.source);
+            if (!sections.compute.empty() && sections.vertex.empty() && sections.fragment.empty()) {
+                AUTOGL_LOG_WARN("EngineGL", "compute shader skipped in dashboard: " + path);
+                continue;
+            }
+
+            DashboardTile t;
+            t.path     = path;
+            t.rootPath = ShaderPreprocessor::normalizePath(path);
+            glCreateProgramPipelines(1, &t.slot.pipeline);
+            watchSources(pre.files);
+            tiles_.push_back(std::move(t));
+        }
+
+        if (tiles_.empty()) {
+            AUTOGL_LOG_ERROR("EngineGL", "dashboard has no graphics shader to show");
+            return;
+        }
+        AUTOGL_LOG_INFO("EngineGL", "dashboard: " + std::to_string(tiles_.size()) + " tiles");
+
+        watcher_.start();
+
+        // variant 선택은 모든 타일에 공통, 같은 파일은 한 번만 빌드
+        // (워커가 있으면 준비된 타일부터 나타나고 창은 바로 뜸)
+        takeRequestedVariant();
+        auto buildAll = [this] {
+            std::unordered_set<std::string> requested;
+            for (const auto& t : tiles_) {
+                if (requested.insert(t.path).second) requestTileBuild(t.path);
+            }
+        };
+        buildAll();
+
+        state_.startTime     = glfwGetTime();
+        state_.prevFrameTime = state_.startTime;
+        state_.frameCount    = 0;
+
+        std::vector<GLuint> uploadedVertex;
+
+        while (!glfwWindowShouldClose(state_.window)) {
+            detail::syncInput(state_);
+
+            if (watcher_.hasChanges()) {
+                std::unordered_set<std::string> roots;
+                for (const auto& changed : watcher_.takeChanges()) {
+                    if (dropChangedMesh(changed)) continue;
+                    for (auto& root : preprocessor_.invalidate(changed)) {
+                        roots.insert(std::move(root));
+                    }
+                }
+
+                std::unordered_set<std::string> rebuilt;
+                for (auto& t : tiles_) {
+                    if (roots.count(t.rootPath) == 0 || rebuilt.count(t.path)) continue;
+
+                    const std::uint64_t hash = hashShaderFile(t.path, &preprocessor_);
+                    if (hash != 0 && hash == t.sourceHash) {
+                        AUTOGL_LOG_DEBUG("EngineGL", t.path + ": content unchanged, reload skipped");
+                        continue;
+                    }
+
+                    AUTOGL_LOG_INFO("EngineGL", t.path + " changed, recompiling");
+                    for (auto& same : tiles_) {
+                        if (same.path == t.path) same.sourceHash = hash;
+                    }
+                    rebuilt.insert(t.path);
+                    requestTileBuild(t.path);
+                }
+            }
+
+            // 대시보드는 variant 캐시 없이 모든 타일을 다시 빌드
+            if (takeRequestedVariant()) {
+                buildAll();
+            }
+
+            if (compiler_.hasResults()) {
+                collectTilePrograms();
+            }
+
+            bool animated  = false;
+            bool usesMouse = false;
+            for (const auto& t : tiles_) {
+                if (!t.slot.stages.valid()) continue;
+                animated  = animated  || t.slot.fragmentLocs.usesTime()  || t.slot.vertexLocs.usesTime() ||
+                            t.slot.computeLocs.usesTime()   || t.slot.stages.compute != 0;
+                usesMouse = usesMouse || t.slot.fragmentLocs.usesMouse() || t.slot.vertexLocs.usesMouse() ||
+                            t.slot.computeLocs.usesMouse();
+            }
+
+            if (shouldDraw(animated, usesMouse)) {
+                state_.glState.bindFramebuffer(0);
+                glClear(GL_COLOR_BUFFER_BIT);
+
+                if (state_.fbWidth > 0 && state_.fbHeight > 0) {
+                    layoutTiles();
+
+                    // 프레임 값은 한 번만 계산, 타일마다 resolution/mouse만 바꿔서 올림
+                    detail::advanceFrameState(state_);
+                    const BuiltinUniformValues frame = detail::captureBuiltinValues(state_);
+
+                    // 모든 타일이 같은 viewport를 쓰므로 루프 밖에서 한 번만 설정 (VAO는 drawSlot에서)
+                    state_.glState.useProgram(0);
+                    state_.glState.viewport(0, 0, tileWidth_, tileHeight_);
+                    uploadedVertex.clear();
+                    static constexpr GLfloat kTileClear[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+                    for (std::size_t i = 0; i < tiles_.size(); ++i) {
+                        DashboardTile& t = tiles_[i];
+                        if (!t.slot.stages.valid()) continue;
+
+                        const float x = static_cast<float>((static_cast<int>(i) % tileCols_) * tileWidth_);
+                        const float y = static_cast<float>(state_.fbHeight
+                                      - (static_cast<int>(i) / tileCols_ + 1) * tileHeight_);
+
+                        BuiltinUniformValues v = frame;
+                        v.resolution[0] = static_cast<float>(tileWidth_);
+                        v.resolution[1] = static_cast<float>(tileHeight_);
+
+                        // iMouse는 커서가 올라가 있는 타일에만 타일 기준 좌표로 전달
+                        const float mx = frame.mouse[0] - x;
+                        const float my = frame.mouse[1] - y;
+                        if (mx >= 0.0f && my >= 0.0f && mx < v.resolution[0] && my < v.resolution[1]) {
+                            v.mouse[0] = mx;
+                            v.mouse[1] = my;
+                            if (state_.mouseDown) {
+                                v.mouse[2] -= x;
+                                v.mouse[3] -= y;
+                            }
+                        }
+                        else {
+                            v.mouse[0] = v.mouse[1] = v.mouse[2] = v.mouse[3] = 0.0f;
+                        }
+
+                        // 공용 vertex stage는 프레임당 한 번만 업로드. 단 iMouse는 타일마다 다르므로
+                        // 쓰는 stage는 매번 올림 (iResolution은 layoutTiles가 모든 타일에 같은 크기를 줌)
+                        const GLuint vs = t.slot.stages.vertex;
+                        if (t.slot.vertexLocs.usesMouse()) {
+                            detail::uploadBuiltinUniforms(vs, t.slot.vertexLocs, v);
+                        }
+                        else if (std::find(uploadedVertex.begin(), uploadedVertex.end(), vs) == uploadedVertex.end()) {
+                            detail::uploadBuiltinUniforms(vs, t.slot.vertexLocs, v);
+                            uploadedVertex.push_back(vs);
+                        }
+                        detail::uploadBuiltinUniforms(t.slot.stages.fragment, t.slot.fragmentLocs, v);
+                        detail::uploadBuiltinUniforms(t.slot.stages.compute,  t.slot.computeLocs,  v);
+
+                        // drawGeometry는 depth만 지우므로 color는 여기서 지움
+                        // (화면 전체를 덮지 않는 @mesh/@instances/discard 타일이 이전 프레임을 남기지 않도록)
+                        state_.glState.bindFramebuffer(t.fbo);
+                        glClearNamedFramebufferfv(t.fbo, GL_COLOR, 0, kTileClear);
+                        state_.glState.bindProgramPipeline(t.slot.pipeline);
+                        drawSlot(t.slot, t.slot.instanceCount);
+                    }
+
+                    // 타일을 기본 framebuffer로 복사 (바인딩을 바꾸지 않는 DSA blit)
+                    state_.glState.bindFramebuffer(0);
+                    for (std::size_t i = 0; i < tiles_.size(); ++i) {
+                        const DashboardTile& t = tiles_[i];
+                        if (!t.slot.stages.valid()) continue;
+
+                        const int x = (static_cast<int>(i) % tileCols_) * tileWidth_;
+                        const int y = state_.fbHeight - (static_cast<int>(i) / tileCols_ + 1) * tileHeight_;
+                        glBlitNamedFramebuffer(t.fbo, 0,
+                            0, 0, tileWidth_, tileHeight_,
+                            x, y, x + tileWidth_, y + tileHeight_,
+                            GL_COLOR_BUFFER_BIT, GL_NEAREST);
+                    }
+                }
+
+                finishFrameDraw();
+            }
+            else {
+                state_.inputChanged = false;
+            }
+
+            waitForEvents(animated);
+        }
+
+        destroyTiles();
+    }
+
+    // ========================================================
+    // Thumbnail atlas
+    // ========================================================
+
+    bool EngineGLBackend::renderThumbnailAtlas(const std::vector<std::string>& shaderPaths,
+                                               const ThumbnailAtlasOptions& opts) {
+        if (shaderPaths.empty()) return false;
+        if (!state_.window && !initContext(false)) return false;
+
+        const auto t0 = std::chrono::steady_clock::now();
+
+        const int count  = static_cast<int>(shaderPaths.size());
+        const int tile   = std::max(1, opts.tileSize);
+        const int cols   = std::max(1, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(count)))));
+        const int rows   = (count + cols - 1) / cols;
+        const int atlasW = cols * tile;
+        const int atlasH = rows * tile;
+
+        GLint maxSize = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+        if (atlasW > maxSize || atlasH > maxSize) {
+            AUTOGL_LOG_ERROR("Thumbnail",
+                "atlas " + std::to_string(atlasW) + "x" + std::to_string(atlasH)
+                + " exceeds GL_MAX_TEXTURE_SIZE, use a smaller tileSize");
+            return false;
+        }
+
+        // 아틀라스 전용 워커: 여러 공유 컨텍스트에서 동시에 컴파일하고,
+        // 렌더 스레드는 끝난 셰이더부터 바로 그림
+        int workers = opts.workers;
+        if (workers <= 0) {
+            workers = std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, 8);
+        }
+        workers = std::min(workers, count);
+
+        AsyncShaderCompiler atlasCompiler;
+        atlasCompiler.init(state_.window, workers);
+
+        GLuint atlas = 0, scratch = 0, depth = 0, fbo = 0, pipeline = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &atlas);
+        glTextureStorage2D(atlas, 1, GL_RGBA8, atlasW, atlasH);
+        glClearTexImage(atlas, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+        // gl_FragCoord가 타일 기준이 되도록 타일 크기 FBO에 그린 뒤 아틀라스로 복사
+        glCreateTextures(GL_TEXTURE_2D, 1, &scratch);
+        glTextureStorage2D(scratch, 1, GL_RGBA8, tile, tile);
+        glCreateFramebuffers(1, &fbo);
+        glNamedFramebufferTexture(fbo, GL_COLOR_ATTACHMENT0, scratch, 0);
+        // @mesh 셰이더는 깊이 테스트로 그림
+        glCreateRenderbuffers(1, &depth);
+        glNamedRenderbufferStorage(depth, GL_DEPTH_COMPONENT24, tile, tile);
+        glNamedFramebufferRenderbuffer(fbo, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+        glCreateProgramPipelines(1, &pipeline);
+
+        // 모든 셰이더가 같은 프레임 값을 받음
+        BuiltinUniformValues values = detail::captureBuiltinValues(state_);
+        values.time          = opts.time;
+        values.timeDelta     = 1.0f / 60.0f;
+        values.frameRate     = 60.0f;
+        values.frame         = 0;
+        values.resolution[0] = static_cast<float>(tile);
+        values.resolution[1] = static_cast<float>(tile);
+        for (float& m : values.mouse) m = 0.0f;
+
+        state_.glState.useProgram(0);
+        state_.glState.bindFramebuffer(fbo);
+        state_.glState.bindProgramPipeline(pipeline);
+        state_.glState.viewport(0, 0, tile, tile);
+
+        std::vector<const char*> status(static_cast<std::size_t>(count), "failed");
+        const GLfloat opaqueBlack[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+        // compute-only 셰이더의 SSBO는 로드한 컨텍스트에서 이미 해제됨 (프로그램만 남음)
+        auto renderTile = [&](int index, LoadedShaderProgram& ls) {
+            if (ls.isCompute) {
+                status[static_cast<std::size_t>(index)] = "compute";
+                if (ls.program) glDeleteProgram(ls.program);
+                return;
+            }
+            if (!ls.stages.valid()) {
+                AUTOGL_LOG_WARN("Thumbnail", "compile failed: " + shaderPaths[static_cast<std::size_t>(index)]);
+                releaseShaderProgram(ls, &stageCache_);
+                return;
+            }
+
+            glUseProgramStages(pipeline, GL_VERTEX_SHADER_BIT,   ls.stages.vertex);
+            glUseProgramStages(pipeline, GL_FRAGMENT_SHADER_BIT, ls.stages.fragment);
+            glUseProgramStages(pipeline, GL_COMPUTE_SHADER_BIT,  ls.stages.compute);
+            const BuiltinUniformLocations computeLocs = detail::QueryBuiltinUniforms(ls.stages.compute);
+            detail::uploadBuiltinUniforms(ls.stages.vertex,
+                detail::QueryBuiltinUniforms(ls.stages.vertex), values);
+            detail::uploadBuiltinUniforms(ls.stages.fragment,
+                detail::QueryBuiltinUniforms(ls.stages.fragment), values);
+            detail::uploadBuiltinUniforms(ls.stages.compute, computeLocs, values);
+
+            // alpha는 1로 고정: 투명하게 출력하는 셰이더도 미리보기에서는 보이도록
+            glClearNamedFramebufferfv(fbo, GL_COLOR, 0, opaqueBlack);
+            // 인스턴스 SSBO는 셰이더마다 새로 만듦 (앞 셰이더가 쓴 내용을 이어받지 않도록)
+            GL::InstanceBuffers instances;
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);
+            drawProgram(instances, ls.stages, computeLocs, ls.indirect, ls.meshPath, ls.instanceCount);
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+            instances.release();
+
+            // 이미지는 위에서 아래로 저장되므로 첫 행을 텍스처 위쪽에 배치
+            const int col = index % cols;
+            const int row = index / cols;
+            glCopyImageSubData(scratch, GL_TEXTURE_2D, 0, 0, 0, 0,
+                               atlas,   GL_TEXTURE_2D, 0, col * tile, (rows - 1 - row) * tile, 0,
+                               tile, tile, 1);
+
+            status[static_cast<std::size_t>(index)] = "ok";
+            releaseShaderProgram(ls, &stageCache_);
+        };
+
+        takeRequestedVariant();
+
+        if (atlasCompiler.available()) {
+            std::unordered_map<std::string, int> indexOf;
+            for (int i = 0; i < count; ++i) {
+                const std::string& path = shaderPaths[static_cast<std::size_t>(i)];
+                indexOf[path] = i;
+                atlasCompiler.submit(path, [this, path, selection = variantSelection_] {
+                    LoadedShaderProgram ls = loadShaderProgram(path, &preprocessor_, &selection, &stageCache_);
+                    // compute-only는 그리지 않으므로 SSBO를 만든 워커 컨텍스트에서 바로 해제
+                    if (ls.isCompute) releaseComputeBuffers(ls);
+                    return ls;
+                });
+            }
+
+            // 경로가 중복되면 submit이 하나로 합치므로 결과 수는 고유 경로 수
+            std::size_t remaining = indexOf.size();
+            while (remaining > 0) {
+                AsyncShaderCompiler::Result r;
+                if (!atlasCompiler.poll(r)) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+                renderTile(indexOf[r.key], r.program);
+                --remaining;
+            }
+            atlasCompiler.shutdown();
+        }
+        else {
+            for (int i = 0; i < count; ++i) {
+                LoadedShaderProgram ls = loadShaderProgram(
+                    shaderPaths[static_cast<std::size_t>(i)], &preprocessor_, &variantSelection_, &stageCache_);
+                if (ls.isCompute) releaseComputeBuffers(ls);
+                renderTile(i, ls);
+            }
+        }
+
+        // 읽어서 위아래 뒤집기 (GL은 아래 행부터)
+        const std::size_t rowBytes = static_cast<std::size_t>(atlasW) * 4;
+        std::vector<std::uint8_t> pixels(rowBytes * static_cast<std::size_t>(atlasH));
+        std::vector<std::uint8_t> flipped(pixels.size());
+        glGetTextureImage(atlas, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                          static_cast<GLsizei>(pixels.size()), pixels.data());
+        for (int y = 0; y < atlasH; ++y) {
+            std::copy_n(pixels.data() + rowBytes * static_cast<std::size_t>(atlasH - 1 - y), rowBytes,
+                        flipped.data() + rowBytes * static_cast<std::size_t>(y));
+        }
+
+        state_.glState.bindFramebuffer(0);
+        state_.glState.forgetFramebuffer(fbo);
+        state_.glState.forgetProgramPipeline(pipeline);
+        glDeleteProgramPipelines(1, &pipeline);
+        glDeleteFramebuffers(1, &fbo);
+        glDeleteRenderbuffers(1, &depth);
+        glDeleteTextures(1, &scratch);
+        glDeleteTextures(1, &atlas);
+
+        const std::string imagePath = opts.outputPath + ".png";
+        const std::string indexPath = opts.outputPath + ".json";
+        if (!WritePNG(imagePath, atlasW, atlasH, flipped.data())) return false;
+
+        std::ofstream json(indexPath, std::ios::trunc);
+        if (!json) {
+            AUTOGL_LOG_ERROR("Thumbnail", "cannot write " + indexPath);
+            return false;
+        }
+
+        int rendered = 0;
+        json << "{\n"
+             << "  \"image\": " << detail::JsonString(fs::path(imagePath).filename().string()) << ",\n"
+             << "  \"width\": " << atlasW << ",\n"
+             << "  \"height\": " << atlasH << ",\n"
+             << "  \"tileSize\": " << tile << ",\n"
+             << "  \"columns\": " << cols << ",\n"
+             << "  \"rows\": " << rows << ",\n"
+             << "  \"time\": " << opts.time << ",\n"
+             << "  \"shaders\": [\n";
+        for (int i = 0; i < count; ++i) {
+            const std::size_t idx = static_cast<std::size_t>(i);
+            if (std::string(status[idx]) == "ok") ++rendered;
+
+            json << "    { \"path\": " << detail::JsonString(shaderPaths[idx])
+                 << ", \"x\": " << (i % cols) * tile
+                 << ", \"y\": " << (i / cols) * tile
+                 << ", \"status\": \"" << status[idx] << "\" }"
+                 << (i + 1 < count ? "," : "") << "\n";
+        }
+        json << "  ]\n}\n";
+
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - t0).count();
+        AUTOGL_LOG_INFO("Thumbnail",
+            std::to_string(rendered) + "/" + std::to_string(count) + " shaders rendered in "
+            + std::to_string(ms) + " ms (" + std::to_string(workers) + " workers) -> " + imagePath);
+        return true;
+    }
+
+    // ========================================================
+    // Batch
+    // ========================================================
+
+    bool EngineGLBackend::runBatch(const std::vector<std::string>& shaderPaths,
+                                   const BatchOptions& opts) {
+        if (shaderPaths.empty()) return false;
+        if (!state_.window && !initContext(false)) return false;
+
+        // 기본은 바이너리 캐시를 꺼서 캐시 히트 없이 실제 컴파일 비용을 잼
+        const std::string cacheDir = ProgramCacheDirectory();
+        if (!opts.useProgramCache) SetProgramCacheDirectory("");
+
+        using Clock = std::chrono::steady_clock;
+        auto msSince = [](Clock::time_point t0) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        };
+
+        const int frames = std::max(1, opts.frames);
+
+        GLuint pipeline = 0;
+        glCreateProgramPipelines(1, &pipeline);
+
+        GL::GpuTimer timer(4);
+        GL::PipelineStatsQuery statsQuery(4);
+        std::vector<double> samples;
+        std::vector<GL::PipelineStats> statSamples;
+        std::vector<detail::BatchRecord> records;
+        records.reserve(shaderPaths.size());
+        bool allOk = true;
+
+        takeRequestedVariant();
+
+        for (const auto& path : shaderPaths) {
+            detail::BatchRecord rec;
+            rec.path = path;
+            samples.clear();
+            statSamples.clear();
+
+            // stage 캐시를 거치지 않음: 공용 vertex stage 재사용 없이 셰이더마다 같은 조건으로 측정
+            LoadedShaderProgram ls = loadShaderProgram(path, &preprocessor_, &variantSelection_, nullptr);
+            rec.timings = ls.timings;
+            rec.kind    = ls.isCompute ? "compute" : "graphics";
+
+            // 인스턴스 SSBO는 셰이더마다 새로 만듦 (결과가 파일 순서에 따라 달라지지 않도록)
+            GL::InstanceBuffers instances;
+
+            state_.startTime     = glfwGetTime();
+            state_.prevFrameTime = state_.startTime;
+            state_.frameCount    = 0;
+
+            bool ok = false;
+            if (ls.isCompute && ls.program) {
+                state_.glState.useProgram(ls.program);
+                const BuiltinUniformLocations locs = detail::QueryBuiltinUniforms(ls.program);
+
+                // 0번은 첫 dispatch 지연만 재고, GPU 통계는 그 뒤 frames번으로 계산
+                ok = true;
+                for (int f = 0; f <= frames && ok; ++f) {
+                    detail::setBuiltinUniforms(ls.program, locs, state_);
+
+                    if (f == 0) {
+                        const auto t0 = Clock::now();
+                        ok = detail::SafeDispatchCompute(ls.program, 1, 1, 1);
+                        glFinish();
+                        rec.firstFrameMs = msSince(t0);
+                        continue;
+                    }
+
+                    timer.begin();
+                    statsQuery.begin();
+                    ok = detail::SafeDispatchCompute(ls.program, 1, 1, 1);
+                    statsQuery.end();
+                    timer.end();
+                    timer.collect(samples);
+                    statsQuery.collect(statSamples);
+                }
+
+                state_.glState.forgetProgram(ls.program);
+            }
+            else if (ls.stages.valid()) {
+                glUseProgramStages(pipeline, GL_VERTEX_SHADER_BIT,   ls.stages.vertex);
+                glUseProgramStages(pipeline, GL_FRAGMENT_SHADER_BIT, ls.stages.fragment);
+                glUseProgramStages(pipeline, GL_COMPUTE_SHADER_BIT,  ls.stages.compute);
+                const BuiltinUniformLocations vertexLocs   = detail::QueryBuiltinUniforms(ls.stages.vertex);
+                const BuiltinUniformLocations fragmentLocs = detail::QueryBuiltinUniforms(ls.stages.fragment);
+                const BuiltinUniformLocations computeLocs  = detail::QueryBuiltinUniforms(ls.stages.compute);
+
+                state_.glState.useProgram(0);
+                state_.glState.bindProgramPipeline(pipeline);
+                state_.glState.bindFramebuffer(0);
+                state_.glState.viewport(0, 0, state_.fbWidth, state_.fbHeight);
+
+                for (int f = 0; f <= frames; ++f) {
+                    detail::advanceFrameState(state_);
+                    const BuiltinUniformValues values = detail::captureBuiltinValues(state_);
+                    detail::uploadBuiltinUniforms(ls.stages.vertex,   vertexLocs,   values);
+                    detail::uploadBuiltinUniforms(ls.stages.fragment, fragmentLocs, values);
+                    detail::uploadBuiltinUniforms(ls.stages.compute,  computeLocs,  values);
+
+                    if (f == 0) {
+                        // 드라이버가 첫 draw에서 하는 지연 컴파일까지 포함
+                        const auto t0 = Clock::now();
+                        drawProgram(instances, ls.stages, computeLocs, ls.indirect,
+                                    ls.meshPath, ls.instanceCount);
+                        glFinish();
+                        rec.firstFrameMs = msSince(t0);
+                        continue;
+                    }
+
+                    // indirect는 compute dispatch까지 한 프레임 비용에 포함
+                    timer.begin();
+                    statsQuery.begin();
+                    drawProgram(instances, ls.stages, computeLocs, ls.indirect,
+                                ls.meshPath, ls.instanceCount);
+                    statsQuery.end();
+                    timer.end();
+                    timer.collect(samples);
+                    statsQuery.collect(statSamples);
+                }
+                ok = true;
+            }
+
+            timer.collect(samples, true);
+            statsQuery.collect(statSamples, true);
+            instances.release();
+            // compute SSBO도 셰이더마다 해제 (다음 셰이더가 같은 binding의 버퍼를 이어받지 않도록)
+            if (ls.isCompute) releaseComputeBuffers(ls);
+            releaseShaderProgram(ls, nullptr);
+
+            rec.stats  = GL::AveragePipelineStats(statSamples, samples);
+            rec.gpu    = Summarize(samples);
+            rec.status = ok ? "ok" : "failed";
+            allOk = allOk && ok;
+
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(2)
+                 << path << ": " << rec.status
+                 << ", compile " << rec.timings.compileMs << " ms"
+                 << ", link " << rec.timings.linkMs << " ms"
+                 << ", first frame " << rec.firstFrameMs << " ms"
+                 << ", gpu median " << rec.gpu.median << " ms";
+            if (rec.stats.samples > 0) line << ", " << detail::FormatPipelineStats(rec.stats);
+            AUTOGL_LOG_INFO("Batch", line.str());
+
+            records.push_back(std::move(rec));
+        }
+
+        timer.release();
+        statsQuery.release();
+        state_.glState.forgetProgramPipeline(pipeline);
+        glDeleteProgramPipelines(1, &pipeline);
+        if (!opts.useProgramCache) SetProgramCacheDirectory(cacheDir);
+
+        // 리포트: 확장자가 .csv면 CSV, 아니면 JSON (경로가 없으면 stdout)
+        const bool csv = fs::path(opts.reportPath).extension() == ".csv";
+        std::ofstream file;
+        if (!opts.reportPath.empty()) {
+            file.open(opts.reportPath, std::ios::trunc);
+            if (!file) {
+                AUTOGL_LOG_ERROR("Batch", "cannot write report " + opts.reportPath);
+                return false;
+            }
+        }
+        std::ostream& os = opts.reportPath.empty() ? std::cout : file;
+        os << std::setprecision(6);
+
+        if (csv) detail::writeBatchCsv(os, records);
+        else     detail::writeBatchJson(os, records, state_.fbWidth, state_.fbHeight, frames);
+
+        if (!opts.reportPath.empty()) {
+            AUTOGL_LOG_INFO("Batch", "report written to " + opts.reportPath);
+        }
+        return allOk;
+    }
+
+    // ========================================================
+    // A/B 비교
+    // ========================================================
+
+    bool EngineGLBackend::runABTest(const std::string& pathA, const std::string& pathB,
+                                    const ABTestOptions& opts) {
+        if (!state_.window && !initContext(false)) return false;
+
+        // 셰이더 하나의 측정 상태. 인스턴스 버퍼는 stage마다 크기를 맞추므로 따로 둠
+        struct Side {
+            const std::string* path = nullptr;
+            LoadedShaderProgram ls;
+            GLuint pipeline = 0;
+            BuiltinUniformLocations computeLocs;
+            GL::InstanceBuffers instances;
+            GL::GpuTimer timer{ 4 };
+            std::vector<double> samples;    // 프레임당 GPU 시간
+            std::vector<double> batchMs;    // 배치별 median (검정 단위)
+        };
+        Side sides[2];
+        sides[0].path = &pathA;
+        sides[1].path = &pathB;
+
+        // 두 셰이더가 같은 프레임 값을 받음 (시간/마우스/난수 고정)
+        state_.startTime     = glfwGetTime();
+        state_.prevFrameTime = state_.startTime;
+        state_.frameCount    = 0;
+        BuiltinUniformValues values = detail::captureBuiltinValues(state_);
+        values.time      = opts.time;
+        values.timeDelta = 1.0f / 60.0f;
+        values.frameRate = 60.0f;
+        values.frame     = 0;
+        values.random    = 0.5f;
+        for (float& m : values.mouse) m = 0.0f;
+
+        takeRequestedVariant();
+
+        bool ok = true;
+        for (Side& side : sides) {
+            // batch와 같이 stage 캐시를 거치지 않음: 두 셰이더가 vertex stage를 공유하지 않도록
+            side.ls = loadShaderProgram(*side.path, &preprocessor_, &variantSelection_, nullptr);
+            if (side.ls.isCompute ? !side.ls.program : !side.ls.stages.valid()) {
+                AUTOGL_LOG_ERROR("ABTest", "cannot build " + *side.path);
+                ok = false;
+                continue;
+            }
+
+            if (side.ls.isCompute) {
+                detail::uploadBuiltinUniforms(side.ls.program, detail::QueryBuiltinUniforms(side.ls.program), values);
+                continue;
+            }
+
+            const GraphicsStages& st = side.ls.stages;
+            glCreateProgramPipelines(1, &side.pipeline);
+            glUseProgramStages(side.pipeline, GL_VERTEX_SHADER_BIT,   st.vertex);
+            glUseProgramStages(side.pipeline, GL_FRAGMENT_SHADER_BIT, st.fragment);
+            glUseProgramStages(side.pipeline, GL_COMPUTE_SHADER_BIT,  st.compute);
+            side.computeLocs = detail::QueryBuiltinUniforms(st.compute);
+            detail::uploadBuiltinUniforms(st.vertex,   detail::QueryBuiltinUniforms(st.vertex),   values);
+            detail::uploadBuiltinUniforms(st.fragment, detail::QueryBuiltinUniforms(st.fragment), values);
+            detail::uploadBuiltinUniforms(st.compute,  side.computeLocs,                          values);
+        }
+
+        // 한 프레임 (compute는 dispatch 한 번). 같은 기본 framebuffer/viewport에 그림
+        auto drawOnce = [&](Side& side) -> bool {
+            if (side.ls.isCompute) {
+                state_.glState.useProgram(side.ls.program);
+                return detail::SafeDispatchCompute(side.ls.program, 1, 1, 1);
+            }
+            state_.glState.useProgram(0);
+            state_.glState.bindProgramPipeline(side.pipeline);
+            drawProgram(side.instances, side.ls.stages, side.computeLocs, side.ls.indirect,
+                        side.ls.meshPath, side.ls.instanceCount);
+            return true;
+        };
+
+        if (ok) {
+            state_.glState.bindFramebuffer(0);
+            state_.glState.viewport(0, 0, state_.fbWidth, state_.fbHeight);
+
+            // 드라이버의 첫 draw 지연 컴파일, 메시 로드, 버퍼 할당을 측정에서 뺌
+            for (Side& side : sides) {
+                for (int f = 0; f < std::max(1, opts.warmupFrames) && ok; ++f) ok = drawOnce(side);
+            }
+            glFinish();
+        }
+
+        // 배치마다 순서를 바꿔 (AB, BA, ...) 클럭/온도 변화가 한쪽에만 몰리지 않게 함
+        const int batches = std::max(1, opts.batches);
+        const int frames  = std::max(1, opts.framesPerBatch);
+        for (int b = 0; b < batches && ok; ++b) {
+            for (int k = 0; k < 2 && ok; ++k) {
+                Side& side = sides[(b + k) % 2];
+                const std::size_t first = side.samples.size();
+                for (int f = 0; f < frames && ok; ++f) {
+                    side.timer.begin();
+                    ok = drawOnce(side);
+                    side.timer.end();
+                    side.timer.collect(side.samples);
+                }
+                // 다음 배치가 이 배치의 GPU 작업과 겹치지 않도록 끝날 때까지 기다림
+                side.timer.collect(side.samples, true);
+                side.batchMs.push_back(Summarize({ side.samples.begin() + static_cast<std::ptrdiff_t>(first),
+                                                   side.samples.end() }).median);
+            }
+        }
+
+        for (Side& side : sides) {
+            side.timer.release();
+            side.instances.release();
+            if (side.pipeline) {
+                state_.glState.forgetProgramPipeline(side.pipeline);
+                glDeleteProgramPipelines(1, &side.pipeline);
+            }
+            if (side.ls.program) state_.glState.forgetProgram(side.ls.program);
+            if (side.ls.isCompute) releaseComputeBuffers(side.ls);
+            releaseShaderProgram(side.ls, nullptr);
+        }
+        if (!ok) {
+            AUTOGL_LOG_ERROR("ABTest", "comparison aborted");
+            return false;
+        }
+
+        const SampleSummary a = Summarize(sides[0].samples);
+        const SampleSummary b = Summarize(sides[1].samples);
+        for (int i = 0; i < 2; ++i) {
+            const SampleSummary& s = i == 0 ? a : b;
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(4)
+                 << (i == 0 ? "A " : "B ") << *sides[i].path << ": " << s.count << " samples"
+                 << ", gpu median " << s.median << " ms, mean " << s.mean
+                 << " ms, p95 " << s.p95 << " ms, stddev " << s.stddev << " ms";
+            AUTOGL_LOG_INFO("ABTest", line.str());
+        }
+
+        // 같은 배치 안의 프레임끼리는 독립이 아니므로 (클럭, 캐시 상태 공유) 배치 median을 표본으로 검정.
+        // median(A) / median(B): 1보다 크면 B가 빠름
+        const ConfidenceInterval speedup = BootstrapMedianRatio(sides[0].batchMs, sides[1].batchMs,
+                                                                opts.confidence);
+        const MannWhitneyResult test = MannWhitneyU(sides[0].batchMs, sides[1].batchMs);
+
+        // 배치 median이 몇 개뿐이면 bootstrap 구간이 좁게 나와도 믿을 수 없으므로 판정하지 않음
+        constexpr int kMinBatches = 5;
+        const char* verdict = batches < kMinBatches ? "insufficient samples"
+                            : speedup.low > 1.0     ? "B is faster"
+                            : speedup.high < 1.0    ? "B is slower"
+                                                    : "no significant difference";
+        if (batches < kMinBatches) {
+            AUTOGL_LOG_WARN("ABTest", "only " + std::to_string(batches) + " batches; use at least " +
+                                      std::to_string(kMinBatches) + " for a verdict");
+        }
+
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(3)
+             << "speedup of B over A: " << speedup.estimate << "x, "
+             << std::setprecision(0) << opts.confidence * 100.0 << "% CI ["
+             << std::setprecision(3) << speedup.low << ", " << speedup.high << "] (bootstrap of batch medians)"
+             << ", Mann-Whitney p = " << std::setprecision(4) << test.pValue
+             << " (" << state_.fbWidth << "x" << state_.fbHeight << ", " << batches << " x " << frames
+             << " frames each) -> " << verdict;
+        AUTOGL_LOG_INFO("ABTest", line.str());
+        return true;
+    }
+
+    // ========================================================
+    // Capture replay
+    // ========================================================
+
+    bool EngineGLBackend::replayCapture(const std::string& path, const ReplayOptions& opts) {
+        GL::CommandReplay replay;
+        if (!replay.load(path)) return false;
+
+        // 캡처한 기본 framebuffer와 같은 크기의 숨김 창
+        if (!state_.window) {
+            state_.width  = replay.width();
+            state_.height = replay.height();
+            if (!initContext(false)) return false;
+        } else if (state_.fbWidth != replay.width() || state_.fbHeight != replay.height()) {
+            AUTOGL_LOG_WARN("Replay", "window size differs from the capture (" + std::to_string(replay.width()) +
+                                      "x" + std::to_string(replay.height()) + ")");
+        }
+
+        using Clock = std::chrono::steady_clock;
+        auto msSince = [](Clock::time_point t0) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        };
+
+        // 객체 생성/업로드는 측정에서 뺌
+        const bool prepared = replay.prepare();
+        if (!prepared) {
+            AUTOGL_LOG_WARN("Replay", "some objects could not be recreated, output may differ");
+        }
+
+        // 드라이버의 첫 draw 지연 컴파일/상태 검증이 섞이지 않도록 전체를 한 번 미리 재생
+        for (std::size_t f = 0; f < replay.frameCount(); ++f) replay.playFrame(f);
+        glFinish();
+
+        const int loops = std::max(1, opts.loops);
+        GL::GpuTimer timer(4);
+        std::vector<double> gpuMs;
+        std::vector<double> cpuMs;
+        cpuMs.reserve(replay.frameCount() * static_cast<std::size_t>(loops));
+
+        const auto start = Clock::now();
+        for (int loop = 0; loop < loops; ++loop) {
+            for (std::size_t f = 0; f < replay.frameCount(); ++f) {
+                const auto t0 = Clock::now();
+                timer.begin();
+                replay.playFrame(f);
+                timer.end();
+                cpuMs.push_back(msSince(t0));
+                timer.collect(gpuMs);
+            }
+        }
+        timer.collect(gpuMs, true);
+        glFinish();
+        const double totalMs = msSince(start);
+
+        const SampleSummary gpu = Summarize(gpuMs);
+        const SampleSummary cpu = Summarize(cpuMs);
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(3)
+             << path << ": " << cpuMs.size() << " frames (" << replay.frameCount() << " x " << loops
+             << ") in " << totalMs << " ms, " << std::setprecision(1)
+             << (totalMs > 0.0 ? 1000.0 * static_cast<double>(cpuMs.size()) / totalMs : 0.0) << " fps"
+             << std::setprecision(3)
+             << ", cpu submit median " << cpu.median << " ms"
+             << ", gpu median " << gpu.median << " ms, p95 " << gpu.p95 << " ms";
+        AUTOGL_LOG_INFO("Replay", line.str());
+
+        bool ok = prepared;
+        if (!opts.imagePath.empty()) {
+            // 재생이 바꾼 바인딩과 무관하게 기본 framebuffer를 읽음 (GL은 아래 행부터)
+            const int w = replay.width();
+            const int h = replay.height();
+            const std::size_t rowBytes = static_cast<std::size_t>(w) * 4;
+            std::vector<std::uint8_t> pixels(rowBytes * static_cast<std::size_t>(h));
+            std::vector<std::uint8_t> flipped(pixels.size());
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+            glPixelStorei(GL_PACK_ALIGNMENT, 4);
+            for (int y = 0; y < h; ++y) {
+                std::copy_n(pixels.data() + rowBytes * static_cast<std::size_t>(h - 1 - y), rowBytes,
+                            flipped.data() + rowBytes * static_cast<std::size_t>(y));
+            }
+            const bool written = WritePNG(opts.imagePath, w, h, flipped.data());
+            if (written) AUTOGL_LOG_INFO("Replay", "last frame written to " + opts.imagePath);
+            ok = ok && written;
+        }
+
+        timer.release();
+        replay.release();
+        glBindProgramPipeline(0);
+        glUseProgram(0);
+        glBindVertexArray(0);
+        state_.glState.invalidate();
+        return ok;
     }
 
 } // namespace AutoGL
@@ -2,6 +2,27 @@
 #pragma once
 #include "engine_backend.hpp"
 #include "autogl_internal.hpp"
+#include "gl_async_compiler.hpp"
+#include "file_watcher.hpp"
+#include "shader_preprocessor.hpp"
+#include "shader_variants.hpp"
+#include "gl_shader_cache.hpp"
+#include "gl_late_latch.hpp"
+#include "gl_query.hpp"
+#include "gl_instance_buffers.hpp"
+#include "gl_mesh.hpp"
+#include "gl_overdraw.hpp"
+#include "gl_profile.hpp"
+#include "gl_user_uniforms.hpp"
+#include "gl_capture.hpp"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 
 namespace AutoGL {
 
@@ -12,18 +33,197 @@ namespace AutoGL {
 
         bool init() override;
         void setWindowSize(int w, int h) override;
+        void setDebugMode(GLDebugMode mode) override;
+        void setProgramCacheDir(const std::string& dir) override;
+        void setShaderVariant(const std::string& name, const std::string& value) override;
+        void setOnDemandRendering(bool enabled) override;
+        void setLateLatchInput(bool enabled) override;
+        void setOverdrawHeatmap(bool enabled) override;
+        void setUniform(const std::string& name, const std::vector<float>& value) override;
+        void setUniformSpecialization(bool enabled, int stableFrames) override;
+        void setShaderProfiling(bool enabled, int readbackInterval) override;
+        std::vector<ShaderProfileRegion> shaderProfile() const override;
+        void setCommandCapture(const std::string& path, int frames) override;
+        void setInstanceCount(int count) override;
+        void setInstanceData(int binding, const void* data, std::size_t bytes) override;
+        InputLatencyStats inputLatency() const override;
+        PipelineStatistics pipelineStatistics() const override;
 
         void mainLoop(const std::string& shaderPath) override;
+        void dashboardLoop(const std::vector<std::string>& shaderPaths) override;
         bool runShaderFile(const std::string& path) override;
+        bool renderThumbnailAtlas(const std::vector<std::string>& shaderPaths,
+                                  const ThumbnailAtlasOptions& opts) override;
+        bool runBatch(const std::vector<std::string>& shaderPaths,
+                      const BatchOptions& opts) override;
+        bool runABTest(const std::string& pathA, const std::string& pathB,
+                       const ABTestOptions& opts) override;
+        bool replayCapture(const std::string& path, const ReplayOptions& opts) override;
 
     private:
         InternalGLState state_;
-        unsigned int currentProgram_ = 0;
+        // 그래픽 셰이더는 separable stage 프로그램을 pipeline 하나에 조합해서 그림
+        struct PipelineSlot {
+            unsigned int pipeline = 0;
+            GraphicsStages stages;              // stage 캐시 참조를 별도로 보유
+            BuiltinUniformLocations vertexLocs;
+            BuiltinUniformLocations fragmentLocs;
+            BuiltinUniformLocations computeLocs;
+            int instanceCount = 0;              // 파일의 @instances
+            GL::InstanceBuffers instances;      // 그래픽 stage SSBO
+            std::string meshPath;               // 파일의 @mesh (비면 fullscreen quad)
+            IndirectDrawInfo indirect;          // 파일의 @indirect
+            std::vector<std::string> profileRegions;    // 파일의 // @profile 구간 이름
+        };
+        PipelineSlot mainSlot_;
+
+        // hot reload 시 공유 컨텍스트에서 컴파일
+        AsyncShaderCompiler compiler_;
+
+        // include 조각 캐시 + 역의존성 그래프, 감시 대상은 include 파일까지 포함
+        ShaderPreprocessor preprocessor_;
+        FileWatcher watcher_;
+
+        // 바뀌지 않은 stage는 재컴파일/재링크하지 않도록 stage 프로그램 보관
+        GL::StageProgramCache stageCache_;
+        // 마지막으로 빌드를 요청한 소스 내용 해시, 같으면 reload 생략 (touch, autosave 등)
+        std::uint64_t requestedSourceHash_ = 0;
+
+        // variant 키 -> 빌드된 stage 조합 (항목마다 stage 캐시 참조 보유)
+        std::unordered_map<std::string, GraphicsStages> variantPrograms_;
+        std::vector<VariantDecl> variantDecls_;
+        VariantSelection variantSelection_;     // 렌더 스레드 소유
+        bool resetTimeOnSwap_ = true;           // 파일 reload는 iTime 리셋, variant 전환은 유지
+
+        // setShaderVariant는 다른 스레드에서도 호출 가능: 다음 프레임 경계에서 반영
+        std::mutex variantMutex_;
+        VariantSelection requestedVariant_;
+        std::atomic<bool> variantDirty_{false};
+        // setInstanceCount/setInstanceData 요청 (다른 스레드에서 호출 가능, 프레임 시작에 반영)
+        std::atomic<int> instanceOverride_{0};
+        std::mutex instanceMutex_;
+        std::vector<std::pair<int, std::vector<unsigned char>>> instanceUploads_;
+        std::atomic<bool> instancesDirty_{false};
+
+        // @mesh 경로 -> 업로드된 메시 (로드 실패도 빈 항목으로 남겨서 매 프레임 다시 읽지 않음)
+        // 여러 타일/variant가 같은 파일을 쓰면 하나를 공유, 파일이 바뀌면 버리고 다시 로드
+        std::unordered_map<std::string, GL::MeshBuffers> meshes_;
+
+        // overdraw heatmap: 요청(setOverdrawHeatmap, F2)은 아무 스레드, 반영은 렌더 스레드.
+        // 켜져 있는 동안 variant 선택에 kOverdrawDefine이 들어감
+        std::atomic<bool> overdrawHeatmap_{false};
+        bool overdrawApplied_ = false;
+        GL::OverdrawHeatmap heatmap_;
+
+        // 사용자 uniform: 요청은 아무 스레드, 반영/업로드는 렌더 스레드 (mainLoop 셰이더).
+        // 특수화가 켜져 있으면 오래 그대로인 값을 kUniformConstPrefix variant로 넣어 const로 빌드
+        std::mutex uniformMutex_;
+        std::map<std::string, std::vector<float>> requestedUniforms_;
+        std::atomic<bool> specializeUniforms_{false};
+        std::atomic<int> specializeFrames_{120};
+        GL::UserUniforms userUniforms_;
+
+        // 셰이더 프로파일링도 같은 방식 (켜져 있는 동안 variant 선택에 kProfileDefine).
+        // 결과는 readback마다 로그로 출력하고 shaderProfile()용으로 보관
+        std::atomic<bool> profiling_{false};
+        std::atomic<int> profileInterval_{120};
+        bool profilingApplied_ = false;
+        GL::ShaderProfiler profiler_;
+        mutable std::mutex profileMutex_;
+        std::vector<ShaderProfileRegion> profileResults_;
+
+        // GL 명령 캡처: 요청은 아무 스레드, 시작/기록은 렌더 스레드 (mainLoop 셰이더)
+        std::mutex captureMutex_;
+        std::string capturePath_;
+        int captureFrames_ = 0;
+        GL::CommandCapture capture_;
+
         bool isComputeMode_ = false;
+        std::atomic<bool> onDemand_{true};     // setOnDemandRendering은 다른 스레드에서 올 수 있음
+
+        // late-latch 입력과 frames-in-flight 제한, 입력→present 지연 측정 (mainLoop 전용)
+        bool lateLatch_ = false;
+        GL::LateLatchBuffer latchBuffer_;
+        GL::FramePacer pacer_;
+        static constexpr std::size_t kLatencyWindow = 1024;    // 최근 샘플만 유지
+        mutable std::mutex latencyMutex_;
+        std::deque<double> latencyMs_;
+
+        // 메인 draw 구간의 파이프라인 통계와 같은 구간 GPU 시간 (mainLoop 전용)
+        GL::PipelineStatsQuery frameStats_;
+        GL::GpuTimer frameTimer_;
+        static constexpr std::size_t kStatsWindow = 256;
+        mutable std::mutex statsMutex_;
+        std::deque<GL::PipelineStats> statsSamples_;
+        std::deque<double> statsGpuMs_;
+
+        // 대시보드: 셰이더마다 pipeline + 타일 크기 FBO를 두고 한 컨텍스트, 한 프레임에 모두 그림
+        // (viewport 오프셋 대신 FBO를 쓰는 이유: gl_FragCoord가 타일 기준이어야 함)
+        struct DashboardTile {
+            std::string path;
+            std::string rootPath;               // invalidate 결과와 비교하는 정규화 경로
+            PipelineSlot slot;
+            unsigned int fbo   = 0;
+            unsigned int color = 0;
+            unsigned int depth = 0;             // @mesh 깊이 테스트용 renderbuffer
+            std::uint64_t sourceHash = 0;       // 마지막으로 빌드를 요청한 내용 해시
+        };
+        std::vector<DashboardTile> tiles_;
+        int tileCols_   = 0;
+        int tileWidth_  = 0;
+        int tileHeight_ = 0;
+
+#ifdef NDEBUG
+        GLDebugMode debugMode_ = GLDebugMode::Off;
+#else
+        GLDebugMode debugMode_ = GLDebugMode::Async;
+#endif
+
+        bool initContext(bool visible = true);
+        GraphicsStages tryLoadProgram(const std::string& path);
+        void swapProgram(PipelineSlot& slot, const GraphicsStages& stages);
+        void releaseStages(const GraphicsStages& stages);
+        void uploadSlotUniforms(const PipelineSlot& slot, const BuiltinUniformValues& values);
+        void setSlotGeometry(PipelineSlot& slot, const LoadedShaderProgram& ls);
+        void drawSlot(PipelineSlot& slot, int instanceCount);
+        void drawProgram(GL::InstanceBuffers& instances, const GraphicsStages& stages,
+                         const BuiltinUniformLocations& computeLocs, const IndirectDrawInfo& indirect,
+                         const std::string& meshPath, int instanceCount);
+        const GL::MeshBuffers* acquireMesh(const std::string& path);
+        bool dropChangedMesh(const std::string& path);
+        void drawGeometry(const GL::MeshBuffers* mesh, int instanceCount,
+                          GLuint commands = 0, int maxDraws = 0);
+        int mainInstanceCount() const;
+        bool applyInstanceRequests();
+        void requestReload(const std::string& path);
+        void submitBuild(const std::string& path);
+        void collectCompiledPrograms();
+        bool shouldDraw(bool animated, bool usesMouse) const;
+        void finishFrameDraw(double inputTime = 0.0);
+        InputSnapshot latchInput();
+        void waitForEvents(bool animated);
+        void runOnRenderThread(const std::function<void()>& loop);
+        void renderMainLoop(const std::string& shaderPath, const std::string& rootPath);
+        void watchSources(const std::vector<std::string>& files);
+
+        void storeVariant(const LoadedShaderProgram& ls);
+        void dropVariantCache();
+        void evictSpecializedVariants(const std::string& keep);
+        bool takeRequestedVariant();
+        void switchVariant(const std::string& path);
+        void applyOverdrawRequest();
+        void applyProfilingRequest();
+        bool applyUniformRequests();
+        void specializeStableUniforms();
+        void collectProfile(bool final);
+        void beginRequestedCapture();
 
-        bool initContext();
-        unsigned int tryLoadProgram(const std::string& path);
-        void swapProgram(unsigned int newProgram);
+        void renderDashboardLoop(const std::vector<std::string>& shaderPaths);
+        void layoutTiles();
+        void requestTileBuild(const std::string& path);
+        void applyTileProgram(const std::string& path, LoadedShaderProgram& ls);
+        void collectTilePrograms();
+        void destroyTiles();
     };
 
 } // namespace AutoGL
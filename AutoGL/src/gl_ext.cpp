@@ -0,0 +1,69 @@
+// src/gl_ext.cpp
+#include "gl_ext.hpp"
+
+#include <GLFW/glfw3.h>
+#include <AutoGL/Log.hpp>
+
+#include <cstring>
+
+namespace AutoGL::GL {
+
+    bool HasExtension(const char* name) {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        for (GLint i = 0; i < count; ++i) {
+            const auto* ext = reinterpret_cast<const char*>(
+                glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+            if (ext && std::strcmp(ext, name) == 0) return true;
+        }
+        return false;
+    }
+
+    const Extensions& QueryExtensions() {
+        static const Extensions ext = [] {
+            Extensions e;
+
+            const char* fn = nullptr;
+            if (HasExtension("GL_KHR_parallel_shader_compile")) {
+                fn = "glMaxShaderCompilerThreadsKHR";
+            } else if (HasExtension("GL_ARB_parallel_shader_compile")) {
+                fn = "glMaxShaderCompilerThreadsARB";
+            }
+
+            if (fn) {
+                e.maxShaderCompilerThreads =
+                    reinterpret_cast<Extensions::PFNMaxShaderCompilerThreads>(glfwGetProcAddress(fn));
+                e.parallelShaderCompile = e.maxShaderCompilerThreads != nullptr;
+            }
+
+            // glad는 4.6 컨텍스트에서만 core 진입점을 채우므로 4.5 이하에서는 ARB 이름으로 로드해서
+            // 같은 glad 포인터에 넣음 (시그니처가 같음)
+            if (!(glMultiDrawArraysIndirectCount && glMultiDrawElementsIndirectCount) &&
+                HasExtension("GL_ARB_indirect_parameters")) {
+                glad_glMultiDrawArraysIndirectCount = reinterpret_cast<PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC>(
+                    glfwGetProcAddress("glMultiDrawArraysIndirectCountARB"));
+                glad_glMultiDrawElementsIndirectCount = reinterpret_cast<PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC>(
+                    glfwGetProcAddress("glMultiDrawElementsIndirectCountARB"));
+            }
+            e.indirectCount = glMultiDrawArraysIndirectCount && glMultiDrawElementsIndirectCount;
+
+            // 새 진입점 없이 쿼리 target만 추가되는 확장이라 지원 여부만 확인
+            e.pipelineStatistics = GLAD_GL_VERSION_4_6 ||
+                                   HasExtension("GL_ARB_pipeline_statistics_query");
+            e.shaderClock = HasExtension("GL_ARB_shader_clock");
+
+            return e;
+        }();
+        return ext;
+    }
+
+    void EnableParallelShaderCompile() {
+        const Extensions& ext = QueryExtensions();
+        if (!ext.parallelShaderCompile) return;
+
+        // 0xFFFFFFFF = 구현이 정하는 최대 스레드 수
+        ext.maxShaderCompilerThreads(0xFFFFFFFFu);
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,38 @@
+// src/gl_ext.hpp
+#pragma once
+#include <glad/glad.h>
+
+// 번들 glad는 core 4.6만 생성되어 있어서 필요한 확장은 여기서 직접 로드한다.
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+
+namespace AutoGL::GL {
+
+    struct Extensions {
+        bool parallelShaderCompile = false;   // KHR/ARB_parallel_shader_compile
+
+        using PFNMaxShaderCompilerThreads = void (APIENTRYP)(GLuint count);
+        PFNMaxShaderCompilerThreads maxShaderCompilerThreads = nullptr;
+
+        // GL 4.6 core 또는 ARB_indirect_parameters: draw 개수를 GPU 버퍼에서 읽는 multi-draw.
+        // ARB 진입점도 glad 포인터(glMultiDraw*IndirectCount)에 넣어 두므로 호출은 항상 glad를 거침
+        // (명령 캡처가 glad 포인터를 바꿔 끼워 기록)
+        bool indirectCount = false;
+
+        // GL 4.6 core 또는 ARB_pipeline_statistics_query: 셰이더 호출 수/클리핑 프리미티브 쿼리
+        bool pipelineStatistics = false;
+
+        // ARB_shader_clock: 셰이더 안에서 읽는 invocation별 clock (프로파일링 모드)
+        bool shaderClock = false;
+    };
+
+    // 현재 컨텍스트 기준으로 한 번만 조회 (gladLoadGL 이후 호출)
+    const Extensions& QueryExtensions();
+
+    bool HasExtension(const char* name);
+
+    // 드라이버가 셰이더를 여러 스레드에서 병렬 컴파일하도록 허용 (컨텍스트별 설정)
+    void EnableParallelShaderCompile();
+
+} // namespace AutoGL::GL
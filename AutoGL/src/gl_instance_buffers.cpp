@@ -0,0 +1,190 @@
+// src/gl_instance_buffers.cpp
+#include "gl_instance_buffers.hpp"
+#include "gl_ext.hpp"
+#include "gl_profile.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace AutoGL::GL {
+
+    namespace {
+        // block 하나에 필요한 바이트 수: 고정 부분 + 크기 미정 top-level 배열이면 stride * count
+        GLsizeiptr requiredBlockSize(GLuint program, GLuint block, int count) {
+            const GLenum props[2] = { GL_BUFFER_DATA_SIZE, GL_NUM_ACTIVE_VARIABLES };
+            GLint vals[2] = { 0, 0 };
+            glGetProgramResourceiv(program, GL_SHADER_STORAGE_BLOCK, block, 2, props, 2, nullptr, vals);
+
+            GLsizeiptr size = vals[0];
+            if (vals[1] <= 0) return size;
+
+            std::vector<GLint> vars(static_cast<std::size_t>(vals[1]));
+            const GLenum varsProp = GL_ACTIVE_VARIABLES;
+            glGetProgramResourceiv(program, GL_SHADER_STORAGE_BLOCK, block, 1, &varsProp,
+                                   vals[1], nullptr, vars.data());
+
+            // 구조체 배열이면 멤버마다 변수가 나오지만 top-level stride는 같음
+            for (GLint v : vars) {
+                const GLenum arrayProps[2] = { GL_TOP_LEVEL_ARRAY_SIZE, GL_TOP_LEVEL_ARRAY_STRIDE };
+                GLint arr[2] = { 1, 0 };
+                glGetProgramResourceiv(program, GL_BUFFER_VARIABLE, static_cast<GLuint>(v),
+                                       2, arrayProps, 2, nullptr, arr);
+                if (arr[0] == 0 && arr[1] > 0) {
+                    size += static_cast<GLsizeiptr>(arr[1]) * count;
+                    break;
+                }
+            }
+            return size;
+        }
+
+        // glClearNamedBufferData가 4바이트 단위로 채우므로 16바이트 단위로 올림
+        GLsizeiptr alignSize(GLsizeiptr size) {
+            return (std::max<GLsizeiptr>(size, 16) + 15) / 16 * 16;
+        }
+    }
+
+    InstanceBuffers::Buffer* InstanceBuffers::find(GLuint binding) {
+        for (auto& b : buffers_) {
+            if (b.binding == binding) return &b;
+        }
+        return nullptr;
+    }
+
+    void InstanceBuffers::reserve(GLuint binding, GLsizeiptr size) {
+        size = alignSize(size);
+
+        Buffer* existing = find(binding);
+        if (existing && existing->size >= size) return;
+
+        // DSA로 생성, compute 경로와 같은 플래그 (DumpAllSSBOs처럼 읽을 수 있도록 MAP_READ)
+        GLuint buffer = 0;
+        glCreateBuffers(1, &buffer);
+        glNamedBufferStorage(buffer, size, nullptr, GL_DYNAMIC_STORAGE_BIT | GL_MAP_READ_BIT);
+        glClearNamedBufferData(buffer, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+
+        AUTOGL_LOG_DEBUG("InstanceBuffers",
+            "binding " + std::to_string(binding) + ": " + std::to_string(size) + " bytes");
+
+        if (existing) {
+            // 키울 때는 기존 내용 유지
+            glCopyNamedBufferSubData(existing->buffer, buffer, 0, 0, existing->size);
+            glDeleteBuffers(1, &existing->buffer);
+            existing->buffer = buffer;
+            existing->size   = size;
+            return;
+        }
+        buffers_.push_back(Buffer{ binding, buffer, size });
+    }
+
+    void InstanceBuffers::prepare(const GraphicsStages& stages, int instanceCount) {
+        if (stages == stages_ && instanceCount == count_) return;
+        stages_ = stages;
+        count_  = instanceCount;
+
+        const int n = std::max(instanceCount, 1);
+        for (GLuint program : { stages.compute, stages.vertex, stages.fragment }) {
+            if (!program) continue;
+
+            GLint blocks = 0;
+            glGetProgramInterfaceiv(program, GL_SHADER_STORAGE_BLOCK, GL_ACTIVE_RESOURCES, &blocks);
+
+            for (GLint i = 0; i < blocks; ++i) {
+                const GLenum bindingProp = GL_BUFFER_BINDING;
+                GLint binding = -1;
+                glGetProgramResourceiv(program, GL_SHADER_STORAGE_BLOCK, static_cast<GLuint>(i),
+                                       1, &bindingProp, 1, nullptr, &binding);
+                if (binding < 0) continue;
+
+                // 프로파일링 누적 버퍼는 엔진이 따로 연결
+                char name[64] = {};
+                glGetProgramResourceName(program, GL_SHADER_STORAGE_BLOCK, static_cast<GLuint>(i),
+                                         sizeof(name), nullptr, name);
+                if (std::string(name) == kProfileBlockName) continue;
+
+                reserve(static_cast<GLuint>(binding),
+                        requiredBlockSize(program, static_cast<GLuint>(i), n));
+            }
+        }
+    }
+
+    void InstanceBuffers::bind() const {
+        for (const auto& b : buffers_) {
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, b.binding, b.buffer);
+        }
+    }
+
+    void InstanceBuffers::upload(GLuint binding, const void* data, std::size_t bytes) {
+        if (!data || bytes == 0) return;
+
+        reserve(binding, static_cast<GLsizeiptr>(bytes));
+        glNamedBufferSubData(find(binding)->buffer, 0, static_cast<GLsizeiptr>(bytes), data);
+    }
+
+    GLuint InstanceBuffers::buffer(GLuint binding) const {
+        for (const auto& b : buffers_) {
+            if (b.binding == binding) return b.buffer;
+        }
+        return 0;
+    }
+
+    void InstanceBuffers::release() {
+        for (const auto& b : buffers_) {
+            glDeleteBuffers(1, &b.buffer);
+        }
+        buffers_.clear();
+        stages_ = {};
+        count_  = -1;
+    }
+
+    void DrawQuad(int instanceCount) {
+        if (instanceCount > 1) glDrawArraysInstanced(GL_TRIANGLES, 0, 6, instanceCount);
+        else                   glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+
+    void ResetIndirectCommands(GLuint commands, int maxDraws) {
+        const GLuint zero = 0;
+        glClearNamedBufferSubData(commands, GL_R32UI, kIndirectCountOffset,
+                                  kIndirectCommandOffset + kIndirectMaxCommandSize * maxDraws,
+                                  GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    }
+
+    void DispatchStageCompute(GLuint program, int invocations) {
+        // 바이너리 캐시에서 로드한 프로그램도 링크 정보로 조회 가능
+        GLint local[3] = { 1, 1, 1 };
+        glGetProgramiv(program, GL_COMPUTE_WORK_GROUP_SIZE, local);
+
+        const GLuint localX = static_cast<GLuint>(std::max(local[0], 1));
+        const GLuint groups = (static_cast<GLuint>(std::max(invocations, 1)) + localX - 1) / localX;
+
+        // 이전 프레임에 fragment stage가 SSBO에 쓴 값을 compute가 읽을 수 있도록
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+        glDispatchCompute(groups, 1, 1);
+
+        // indirect 명령 + 그래픽 stage의 SSBO 읽기
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+    }
+
+    void MultiDrawIndirect(GLuint commands, int maxDraws, bool indexed) {
+        const Extensions& ext = QueryExtensions();
+        const auto* first = reinterpret_cast<const void*>(kIndirectCommandOffset);
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands);
+        if (!ext.indirectCount) {
+            // drawCount는 무시하고 최대 개수만큼 (빈 명령은 instanceCount 0)
+            if (indexed) glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, first, maxDraws, 0);
+            else         glMultiDrawArraysIndirect(GL_TRIANGLES, first, maxDraws, 0);
+            return;
+        }
+
+        glBindBuffer(GL_PARAMETER_BUFFER, commands);
+        if (indexed) {
+            glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT, first,
+                                             kIndirectCountOffset, maxDraws, 0);
+        } else {
+            glMultiDrawArraysIndirectCount(GL_TRIANGLES, first, kIndirectCountOffset, maxDraws, 0);
+        }
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,82 @@
+// src/gl_instance_buffers.hpp
+#pragma once
+#include <cstddef>
+#include <vector>
+#include <glad/glad.h>
+
+#include "glsl_loader.hpp"
+
+namespace AutoGL::GL {
+
+    // 그래픽 stage(+ 같은 파일의 compute stage)가 쓰는 SSBO (@instances 셰이더의 per-instance 데이터).
+    // stage 프로그램의 shader storage block을 reflection해서 compute 경로처럼 DSA 버퍼를
+    // 만들고 binding 슬롯에 연결한다. 크기를 정하지 않은 배열([])은 인스턴스 수만큼 할당.
+    // 버텍스 셰이더에서는 gl_InstanceID로 인덱싱 (vertex pulling)
+    //
+    // 워커 컨텍스트와는 binding 상태가 공유되지 않으므로 렌더 스레드에서만 사용
+    class InstanceBuffers {
+    public:
+        InstanceBuffers() = default;
+        InstanceBuffers(const InstanceBuffers&) = delete;
+        InstanceBuffers& operator=(const InstanceBuffers&) = delete;
+        InstanceBuffers(InstanceBuffers&&) = default;
+        InstanceBuffers& operator=(InstanceBuffers&&) = default;
+
+        // stage 조합이나 인스턴스 수가 바뀌었을 때만 다시 reflection/할당.
+        // 이미 충분히 큰 버퍼는 내용째 그대로 유지 (reload해도 업로드한 데이터가 남음)
+        void prepare(const GraphicsStages& stages, int instanceCount);
+
+        // draw 직전에 binding 슬롯 연결 (대시보드 타일끼리 binding이 겹칠 수 있어서 매번)
+        void bind() const;
+
+        // binding 버퍼에 data를 씀, 작으면 새로 할당
+        void upload(GLuint binding, const void* data, std::size_t bytes);
+
+        // binding 버퍼를 최소 size 바이트로 (셰이더에 선언이 없어도 생성, 내용 유지)
+        void reserve(GLuint binding, GLsizeiptr size);
+
+        // 없으면 0
+        GLuint buffer(GLuint binding) const;
+
+        // 소유자가 GL 컨텍스트가 current인 스레드에서 명시적으로 호출
+        void release();
+
+    private:
+        struct Buffer {
+            GLuint binding = 0;
+            GLuint buffer  = 0;
+            GLsizeiptr size = 0;
+        };
+
+        std::vector<Buffer> buffers_;
+        GraphicsStages stages_;
+        int count_ = -1;
+
+        Buffer* find(GLuint binding);
+    };
+
+    // fullscreen quad VAO가 바인딩된 상태에서 호출, instanceCount > 1 이면 instanced draw
+    void DrawQuad(int instanceCount);
+
+    // @indirect 명령 버퍼 레이아웃 (std430):
+    //   offset 0  : uint drawCount (compute가 atomicAdd로 채움, dispatch 전에 0으로 초기화)
+    //   offset 16 : 명령 배열. quad는 DrawArraysIndirectCommand (uint 4개),
+    //               메시는 DrawElementsIndirectCommand (uint 5개)
+    constexpr GLintptr   kIndirectCountOffset   = 0;
+    constexpr GLintptr   kIndirectCommandOffset = 16;
+    constexpr GLsizeiptr kIndirectMaxCommandSize = 5 * sizeof(GLuint);
+
+    // drawCount와 명령 배열을 0으로 (compute가 다시 채우기 전).
+    // indirect count를 지원하지 않는 드라이버는 maxDraws개를 모두 그리므로
+    // 채워지지 않은 명령도 instanceCount 0인 빈 draw가 되도록 배열까지 지움
+    void ResetIndirectCommands(GLuint commands, int maxDraws);
+
+    // pipeline의 compute stage를 invocations개 이상 덮도록 x 방향 dispatch 후,
+    // 결과를 draw 명령/SSBO로 읽을 수 있게 barrier
+    void DispatchStageCompute(GLuint program, int invocations);
+
+    // quad 또는 메시 VAO가 바인딩된 상태에서 호출: 명령 개수를 GPU 버퍼에서 읽음 (CPU readback 없음).
+    // indexed면 DrawElementsIndirectCommand (GL_UNSIGNED_INT 인덱스)
+    void MultiDrawIndirect(GLuint commands, int maxDraws, bool indexed);
+
+} // namespace AutoGL::GL
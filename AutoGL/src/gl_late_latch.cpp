@@ -0,0 +1,90 @@
+// src/gl_late_latch.cpp
+#include "gl_late_latch.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <regex>
+
+namespace AutoGL {
+
+    namespace {
+        std::atomic<bool> g_lateLatchInput{false};
+
+        void rewriteMouseDecl(std::string& source) {
+            if (source.empty()) return;
+
+            static const std::regex decl(
+                R"(uniform\s+(?:(?:lowp|mediump|highp)\s+)?vec4\s+iMouse\s*;)");
+            source = std::regex_replace(source, decl,
+                std::string("layout(std140) uniform ") + kLateLatchBlockName + " { vec4 iMouse; };");
+        }
+    }
+
+    void SetLateLatchInput(bool enabled) {
+        g_lateLatchInput.store(enabled, std::memory_order_release);
+    }
+
+    bool LateLatchInputEnabled() {
+        return g_lateLatchInput.load(std::memory_order_acquire);
+    }
+
+    void RewriteLateLatchInput(ShaderSourceSet& sections) {
+        rewriteMouseDecl(sections.vertex);
+        rewriteMouseDecl(sections.fragment);
+    }
+
+} // namespace AutoGL
+
+namespace AutoGL::GL {
+
+    bool LateLatchBuffer::create(std::size_t slots) {
+        release();
+
+        GLint align = 256;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align);
+        if (align < 16) align = 16;
+
+        stride_ = (16 + static_cast<std::size_t>(align) - 1) / align * align;
+        slots_  = slots ? slots : 1;
+        next_   = 0;
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const GLsizeiptr size  = static_cast<GLsizeiptr>(stride_ * slots_);
+
+        glCreateBuffers(1, &buffer_);
+        glNamedBufferStorage(buffer_, size, nullptr, flags);
+        mapped_ = static_cast<unsigned char*>(glMapNamedBufferRange(buffer_, 0, size, flags));
+
+        if (!mapped_) {
+            AUTOGL_LOG_WARN("LateLatch", "persistent mapping failed, late-latch input disabled");
+            release();
+            return false;
+        }
+        std::memset(mapped_, 0, static_cast<std::size_t>(size));
+        return true;
+    }
+
+    void LateLatchBuffer::write(const float mouse[4]) {
+        if (!mapped_) return;
+
+        const std::size_t offset = next_ * stride_;
+        std::memcpy(mapped_ + offset, mouse, 4 * sizeof(float));
+        glBindBufferRange(GL_UNIFORM_BUFFER, kLateLatchBlockBinding, buffer_,
+                          static_cast<GLintptr>(offset), 4 * sizeof(float));
+
+        next_ = (next_ + 1) % slots_;
+    }
+
+    void LateLatchBuffer::release() {
+        if (buffer_) {
+            if (mapped_) glUnmapNamedBuffer(buffer_);
+            glDeleteBuffers(1, &buffer_);
+        }
+        buffer_ = 0;
+        mapped_ = nullptr;
+        stride_ = slots_ = next_ = 0;
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,55 @@
+// src/gl_late_latch.hpp
+#pragma once
+#include <cstddef>
+#include <glad/glad.h>
+
+#include "shader_regex.hpp"
+
+namespace AutoGL {
+
+    // late-latch 모드에서 iMouse를 담는 uniform block (std140, vec4 하나)
+    constexpr GLuint kLateLatchBlockBinding = 15;
+    constexpr const char* kLateLatchBlockName = "AutoGLInput";
+
+    // 켜면 loadShaderProgram이 그래픽 섹션의 iMouse 선언을 uniform block으로 바꿔서 빌드
+    // (컴파일 워커 스레드에서도 읽음)
+    void SetLateLatchInput(bool enabled);
+    bool LateLatchInputEnabled();
+
+    // `uniform vec4 iMouse;` → `layout(std140) uniform AutoGLInput { vec4 iMouse; };`
+    // 멤버 이름이 그대로라 셰이더 본문은 수정할 필요 없음
+    void RewriteLateLatchInput(ShaderSourceSet& sections);
+
+} // namespace AutoGL
+
+namespace AutoGL::GL {
+
+    // persistent + coherent 매핑 uniform 버퍼 링.
+    // draw 직전에 최신 입력을 다음 슬롯에 쓰고 그 범위를 바인딩하므로 GPU는 실행할 때 값을 읽는다.
+    // 아직 GPU가 읽는 중인 슬롯을 덮어쓰지 않는 것은 FramePacer의 frames-in-flight 제한이 보장
+    // (슬롯 수 > 제한 프레임 수)
+    class LateLatchBuffer {
+    public:
+        LateLatchBuffer() = default;
+        LateLatchBuffer(const LateLatchBuffer&) = delete;
+        LateLatchBuffer& operator=(const LateLatchBuffer&) = delete;
+
+        bool create(std::size_t slots = 3);
+
+        // 다음 슬롯에 iMouse 값을 쓰고 kLateLatchBlockBinding에 바인딩
+        void write(const float mouse[4]);
+
+        // 소유자가 GL 컨텍스트가 current인 스레드에서 명시적으로 호출
+        void release();
+
+        bool valid() const noexcept { return buffer_ != 0; }
+
+    private:
+        GLuint buffer_ = 0;
+        unsigned char* mapped_ = nullptr;
+        std::size_t stride_ = 0;
+        std::size_t slots_  = 0;
+        std::size_t next_   = 0;
+    };
+
+} // namespace AutoGL::GL
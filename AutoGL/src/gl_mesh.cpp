@@ -0,0 +1,84 @@
+// src/gl_mesh.cpp
+#include "gl_mesh.hpp"
+#include "gl_instance_buffers.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace AutoGL::GL {
+
+    MeshBuffers::MeshBuffers(MeshBuffers&& o) noexcept
+        : vao_(std::exchange(o.vao_, 0)),
+          buffer_(std::exchange(o.buffer_, 0)),
+          indexCount_(std::exchange(o.indexCount_, 0)) {}
+
+    MeshBuffers& MeshBuffers::operator=(MeshBuffers&& o) noexcept {
+        if (this != &o) {
+            std::swap(vao_, o.vao_);
+            std::swap(buffer_, o.buffer_);
+            std::swap(indexCount_, o.indexCount_);
+        }
+        return *this;
+    }
+
+    bool MeshBuffers::create(const MeshData& mesh) {
+        release();
+        if (mesh.vertices.empty() || mesh.indices.empty()) return false;
+        if (mesh.indices.size() > static_cast<std::size_t>(std::numeric_limits<GLsizei>::max())) {
+            AUTOGL_LOG_ERROR("GLMesh", "too many indices for one draw");
+            return false;
+        }
+
+        // 인덱스 바로 뒤에 정점 (인덱스 크기가 4의 배수라 정점 offset도 4바이트 정렬)
+        const auto indexBytes  = static_cast<GLsizeiptr>(mesh.indices.size() * sizeof(std::uint32_t));
+        const auto vertexBytes = static_cast<GLsizeiptr>(mesh.vertices.size() * sizeof(MeshVertex));
+
+        glCreateBuffers(1, &buffer_);
+        glNamedBufferStorage(buffer_, indexBytes + vertexBytes, nullptr, GL_DYNAMIC_STORAGE_BIT);
+        glNamedBufferSubData(buffer_, 0, indexBytes, mesh.indices.data());
+        glNamedBufferSubData(buffer_, indexBytes, vertexBytes, mesh.vertices.data());
+
+        glCreateVertexArrays(1, &vao_);
+        glVertexArrayVertexBuffer(vao_, 0, buffer_, indexBytes, sizeof(MeshVertex));
+        glVertexArrayElementBuffer(vao_, buffer_);
+
+        glVertexArrayAttribFormat(vao_, 0, 3, GL_FLOAT, GL_FALSE, offsetof(MeshVertex, position));
+        glVertexArrayAttribBinding(vao_, 0, 0);
+        glEnableVertexArrayAttrib(vao_, 0);
+
+        glVertexArrayAttribFormat(vao_, 1, 2, GL_FLOAT, GL_FALSE, offsetof(MeshVertex, uv));
+        glVertexArrayAttribBinding(vao_, 1, 0);
+        glEnableVertexArrayAttrib(vao_, 1);
+
+        glVertexArrayAttribFormat(vao_, 2, 3, GL_FLOAT, GL_FALSE, offsetof(MeshVertex, normal));
+        glVertexArrayAttribBinding(vao_, 2, 0);
+        glEnableVertexArrayAttrib(vao_, 2);
+
+        indexCount_ = static_cast<GLsizei>(mesh.indices.size());
+        return true;
+    }
+
+    void MeshBuffers::release() {
+        if (vao_)    glDeleteVertexArrays(1, &vao_);
+        if (buffer_) glDeleteBuffers(1, &buffer_);
+        vao_ = 0;
+        buffer_ = 0;
+        indexCount_ = 0;
+    }
+
+    void MeshBuffers::draw(int instanceCount) const {
+        if (instanceCount > 1) {
+            glDrawElementsInstanced(GL_TRIANGLES, indexCount_, GL_UNSIGNED_INT, nullptr, instanceCount);
+        } else {
+            glDrawElements(GL_TRIANGLES, indexCount_, GL_UNSIGNED_INT, nullptr);
+        }
+    }
+
+    void MeshBuffers::drawIndirect(GLuint commands, int maxDraws) const {
+        MultiDrawIndirect(commands, maxDraws, true);
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,46 @@
+// src/gl_mesh.hpp
+#pragma once
+#include <glad/glad.h>
+
+#include "mesh_loader.hpp"
+
+namespace AutoGL::GL {
+
+    // @mesh 정점 + 인덱스를 immutable 버퍼 하나에 담고 VAO로 연결.
+    // 정점 레이아웃은 MeshVertex (location 0 = vec3 position, 1 = vec2 uv, 2 = vec3 normal)
+    //
+    // VAO는 컨텍스트 간 공유되지 않으므로 렌더 스레드에서 생성/사용
+    class MeshBuffers {
+    public:
+        MeshBuffers() = default;
+        ~MeshBuffers() = default;   // 소유자가 release()를 명시적으로 호출
+
+        MeshBuffers(const MeshBuffers&) = delete;
+        MeshBuffers& operator=(const MeshBuffers&) = delete;
+        MeshBuffers(MeshBuffers&& o) noexcept;
+        MeshBuffers& operator=(MeshBuffers&& o) noexcept;
+
+        // glNamedBufferStorage 한 번으로 [인덱스 | 정점] 크기를 잡고 채움
+        // (인덱스가 offset 0이라 indirect 명령의 firstIndex를 메시 기준으로 그대로 씀)
+        bool create(const MeshData& mesh);
+        void release();
+
+        bool valid() const noexcept { return vao_ != 0; }
+        GLuint vao() const noexcept { return vao_; }
+
+        // vao()가 바인딩된 상태에서 호출, instanceCount > 1 이면 instanced draw
+        void draw(int instanceCount) const;
+
+        // vao()가 바인딩된 상태에서 호출: commands 버퍼의 DrawElementsIndirectCommand로 그림
+        // (레이아웃은 gl_instance_buffers.hpp의 kIndirect* 참고)
+        void drawIndirect(GLuint commands, int maxDraws) const;
+
+        GLsizei indexCount() const noexcept { return indexCount_; }
+
+    private:
+        GLuint vao_    = 0;
+        GLuint buffer_ = 0;
+        GLsizei indexCount_ = 0;
+    };
+
+} // namespace AutoGL::GL
@@ -0,0 +1,157 @@
+// src/gl_overdraw.cpp
+#include "gl_overdraw.hpp"
+#include "gl_shader_common.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <regex>
+#include <string>
+
+namespace AutoGL {
+
+    namespace {
+        // image load/store와 layout(binding)은 GLSL 4.20부터 core, 그 전 버전은 확장으로 켬
+        void requireImageLoadStore(std::string& source) {
+            const std::size_t ver = source.find("#version");
+            if (ver == std::string::npos) return;
+
+            const long version = std::strtol(source.c_str() + ver + 8, nullptr, 10);
+            if (version >= 420) return;
+
+            std::size_t eol = source.find('\n', ver);
+            if (eol == std::string::npos) {
+                source += '\n';
+                eol = source.size() - 1;
+            }
+
+            // 끼운 줄만큼 밀린 줄 번호를 되돌림
+            const int versionLine = 1 + static_cast<int>(std::count(source.begin(), source.begin() + ver, '\n'));
+            source.insert(eol + 1, "#extension GL_ARB_shader_image_load_store : require\n"
+                                   "#extension GL_ARB_shading_language_420pack : require\n"
+                                   "#line " + std::to_string(versionLine + 1) + "\n");
+        }
+    }
+
+    void InjectOverdrawCounter(ShaderSourceSet& sections) {
+        std::string& fs = sections.fragment;
+        if (fs.empty()) return;
+
+        static const std::regex mainDecl(R"(\bvoid\s+main\s*\()");
+        if (!std::regex_search(fs, mainDecl)) {
+            AUTOGL_LOG_WARN("Overdraw", "fragment stage has no main(), not instrumented");
+            return;
+        }
+        fs = std::regex_replace(fs, mainDecl, "void autogl_UserMain(");
+        requireImageLoadStore(fs);
+
+        // 원래 main 뒤에 붙이므로 사용자 코드의 줄 번호는 그대로
+        const bool lateDepth = fs.find("discard") != std::string::npos ||
+                               fs.find("gl_FragDepth") != std::string::npos;
+        fs += "\n";
+        if (!lateDepth && fs.find("early_fragment_tests") == std::string::npos) {
+            fs += "layout(early_fragment_tests) in;\n";
+        }
+        fs += "layout(binding = " + std::to_string(kOverdrawImageUnit) +
+              ", r32ui) uniform coherent uimage2D autogl_OverdrawCount;\n"
+              "void main() {\n"
+              "    imageAtomicAdd(autogl_OverdrawCount, ivec2(gl_FragCoord.xy), 1u);\n"
+              "    autogl_UserMain();\n"
+              "}\n";
+    }
+
+} // namespace AutoGL
+
+namespace AutoGL::GL {
+
+    bool OverdrawHeatmap::createProgram() {
+        static const char* kVertex = R"(#version 450 core
+layout(location = 0) in vec2 aPos;
+void main() { gl_Position = vec4(aPos, 0.0, 1.0); }
+)";
+
+        // 1회 = 파랑 → 청록 → 초록 → 노랑 → kSaturation회 이상 = 빨강
+        const std::string fragment =
+            "#version 450 core\n"
+            "layout(binding = " + std::to_string(kOverdrawImageUnit) +
+            ", r32ui) uniform readonly uimage2D uCounts;\n"
+            "out vec4 FragColor;\n"
+            "void main() {\n"
+            "    uint n = imageLoad(uCounts, ivec2(gl_FragCoord.xy)).r;\n"
+            "    if (n == 0u) discard;\n"
+            "    float t = clamp((float(n) - 1.0) / " + std::to_string(kSaturation - 1) + ".0, 0.0, 1.0);\n"
+            "    vec3 c = clamp(vec3(min(4.0 * t - 1.5, 4.5 - 4.0 * t),\n"
+            "                        min(4.0 * t - 0.5, 3.5 - 4.0 * t),\n"
+            "                        min(4.0 * t + 0.5, 2.5 - 4.0 * t)), 0.0, 1.0);\n"
+            "    FragColor = vec4(c, 0.75);\n"
+            "}\n";
+
+        GLuint vs = CompileShaderSource(ShaderStage::Vertex, kVertex, "overdraw heatmap");
+        GLuint fs = CompileShaderSource(ShaderStage::Fragment, fragment, "overdraw heatmap");
+        if (!vs || !fs) {
+            if (vs) glDeleteShader(vs);
+            if (fs) glDeleteShader(fs);
+            return false;
+        }
+
+        program_ = glCreateProgram();
+        glAttachShader(program_, vs);
+        glAttachShader(program_, fs);
+        glLinkProgram(program_);
+        glDeleteShader(vs);
+        glDeleteShader(fs);
+
+        GLint ok = 0;
+        glGetProgramiv(program_, GL_LINK_STATUS, &ok);
+        if (!ok) {
+            char log[2048];
+            glGetProgramInfoLog(program_, 2048, nullptr, log);
+            AUTOGL_LOG_ERROR("Overdraw", std::string("heatmap link failed: ") + log);
+            glDeleteProgram(program_);
+            program_ = 0;
+            return false;
+        }
+        return true;
+    }
+
+    bool OverdrawHeatmap::begin(int width, int height) {
+        if (width <= 0 || height <= 0) return false;
+        if (!program_ && !createProgram()) return false;
+
+        if (!texture_ || width != width_ || height != height_) {
+            if (texture_) glDeleteTextures(1, &texture_);
+            glCreateTextures(GL_TEXTURE_2D, 1, &texture_);
+            glTextureStorage2D(texture_, 1, GL_R32UI, width, height);
+            width_  = width;
+            height_ = height;
+        }
+
+        const GLuint zero = 0;
+        glClearTexImage(texture_, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+        glBindImageTexture(kOverdrawImageUnit, texture_, 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
+        return true;
+    }
+
+    void OverdrawHeatmap::drawOverlay() const {
+        if (!program_ || !texture_) return;
+
+        // 계측된 draw의 image atomic → 여기서 읽기, 다음 프레임의 clear
+        glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT);
+
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glDisable(GL_BLEND);
+    }
+
+    void OverdrawHeatmap::release() {
+        if (texture_) glDeleteTextures(1, &texture_);
+        if (program_) glDeleteProgram(program_);
+        texture_ = 0;
+        program_ = 0;
+        width_   = 0;
+        height_  = 0;
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,53 @@
+// src/gl_overdraw.hpp
+#pragma once
+#include <glad/glad.h>
+
+#include "shader_regex.hpp"
+
+namespace AutoGL {
+
+    // overdraw heatmap 모드는 variant define 하나로 표현: 켜면 선택에 AUTOGL_OVERDRAW=1이 들어가서
+    // 계측된 프로그램이 variant 캐시에 따로 들어가고, 끄고 켤 때 다시 컴파일하지 않음
+    constexpr const char* kOverdrawDefine = "AUTOGL_OVERDRAW";
+    constexpr GLuint kOverdrawImageUnit = 7;
+
+    // fragment 섹션의 main을 감싸서 호출될 때마다 픽셀의 카운터를 imageAtomicAdd로 올림.
+    // discard/gl_FragDepth가 없으면 early_fragment_tests를 붙여서 계측 전과 같이
+    // depth test에서 걸러진 fragment는 세지 않음 (image 쓰기가 있으면 드라이버가 late Z로 바꾸므로)
+    void InjectOverdrawCounter(ShaderSourceSet& sections);
+
+} // namespace AutoGL
+
+namespace AutoGL::GL {
+
+    // 픽셀별 fragment 호출 수를 담는 R32UI 텍스처와 이를 히트맵으로 덮어 그리는 프로그램.
+    // 1회 = 파랑, kSaturation회 이상 = 빨강, 0회인 픽셀은 원래 출력 그대로
+    class OverdrawHeatmap {
+    public:
+        static constexpr int kSaturation = 8;
+
+        OverdrawHeatmap() = default;
+        OverdrawHeatmap(const OverdrawHeatmap&) = delete;
+        OverdrawHeatmap& operator=(const OverdrawHeatmap&) = delete;
+
+        // draw 전에 호출: 카운터를 framebuffer 크기로 맞춰 0으로 지우고 image unit에 바인딩
+        bool begin(int width, int height);
+
+        // quad VAO와 program()이 바인딩된 상태에서 호출: 카운트를 현재 framebuffer 위에 blend
+        void drawOverlay() const;
+
+        GLuint program() const noexcept { return program_; }
+
+        // 소유자가 GL 컨텍스트가 current인 스레드에서 명시적으로 호출
+        void release();
+
+    private:
+        GLuint texture_ = 0;
+        GLuint program_ = 0;
+        int width_  = 0;
+        int height_ = 0;
+
+        bool createProgram();
+    };
+
+} // namespace AutoGL::GL
@@ -0,0 +1,274 @@
+// src/gl_profile.cpp
+#include "gl_profile.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <regex>
+#include <set>
+#include <string>
+
+namespace AutoGL {
+
+    namespace {
+        // `// @profile begin name` / `// @profile end name` 한 줄
+        const std::regex& markerRegex() {
+            static const std::regex re(R"(^\s*//\s*@profile\s+(begin|end)\s+([A-Za-z_]\w*))");
+            return re;
+        }
+
+        template <typename Fn>
+        void forEachLine(const std::string& source, Fn&& fn) {
+            std::size_t pos = 0;
+            while (pos < source.size()) {
+                std::size_t eol = source.find('\n', pos);
+                if (eol == std::string::npos) eol = source.size();
+                fn(pos, eol);
+                pos = eol + 1;
+            }
+        }
+
+        void scanSection(const std::string& source, std::vector<std::string>& names) {
+            forEachLine(source, [&](std::size_t b, std::size_t e) {
+                std::smatch m;
+                const std::string line = source.substr(b, e - b);
+                if (std::regex_search(line, m, markerRegex()) && m[1] == "begin" &&
+                    std::find(names.begin(), names.end(), m[2].str()) == names.end()) {
+                    names.push_back(m[2].str());
+                }
+            });
+        }
+
+        // 마커 줄을 같은 줄 수의 코드로 바꿈 (사용자 코드의 줄 번호가 그대로 유지됨). 바꾼 게 있으면 true
+        bool rewriteMarkers(std::string& source, const std::vector<std::string>& regions) {
+            std::string out;
+            out.reserve(source.size() + 256);
+            std::set<std::size_t> opened;
+            bool changed = false;
+
+            forEachLine(source, [&](std::size_t b, std::size_t e) {
+                std::smatch m;
+                const std::string line = source.substr(b, e - b);
+                if (!std::regex_search(line, m, markerRegex())) {
+                    out.append(line);
+                } else {
+                    const auto it = std::find(regions.begin(), regions.end(), m[2].str());
+                    const std::size_t id = static_cast<std::size_t>(it - regions.begin());
+                    const std::string var = "autogl_ProfileT" + std::to_string(id);
+
+                    if (m[1] == "begin") {
+                        out += "uvec2 " + var + " = clock2x32ARB();";
+                        opened.insert(id);
+                        changed = true;
+                    } else if (it != regions.end() && opened.count(id)) {
+                        out += "autogl_ProfileAdd(" + std::to_string(id) + "u, " + var + ");";
+                        changed = true;
+                    } else {
+                        AUTOGL_LOG_WARN("Profile", "@profile end " + m[2].str() + " without begin, ignored");
+                    }
+                }
+                if (e < source.size()) out += '\n';
+            });
+
+            if (changed) source.swap(out);
+            return changed;
+        }
+
+        // #version / #extension 뒤 (다른 코드보다 앞)에 선언을 끼울 위치와, 그 다음 줄의 원래 줄 번호.
+        // 앞선 주입(variant define 등)이 남긴 #line도 따라가서 계산
+        std::size_t declarationPoint(const std::string& source, int& nextLine) {
+            static const std::regex directive(R"(^\s*#\s*(version|extension))");
+            static const std::regex lineDirective(R"(^\s*#\s*line\s+(\d+))");
+
+            std::size_t insertAt = 0;
+            int logical = 1;
+            nextLine = 1;
+            forEachLine(source, [&](std::size_t b, std::size_t e) {
+                const std::string line = source.substr(b, e - b);
+                std::smatch m;
+                if (std::regex_search(line, m, lineDirective)) {
+                    logical = std::atoi(m[1].str().c_str());
+                } else {
+                    ++logical;
+                }
+                if (std::regex_search(line, directive)) {
+                    insertAt = std::min(e + 1, source.size());
+                    nextLine = logical;
+                }
+            });
+            return insertAt;
+        }
+
+        void injectDeclarations(std::string& source) {
+            int nextLine = 1;
+            const std::size_t at = declarationPoint(source, nextLine);
+
+            std::string block;
+            if (at == source.size() && !source.empty() && source.back() != '\n') block += '\n';
+
+            // SSBO와 layout(binding)은 GLSL 4.30 / 4.20부터 core
+            const std::size_t ver = source.find("#version");
+            const long version = ver == std::string::npos ? 0 : std::strtol(source.c_str() + ver + 8, nullptr, 10);
+            block += "#extension GL_ARB_shader_clock : require\n";
+            if (version < 430) block += "#extension GL_ARB_shader_storage_buffer_object : require\n";
+            if (version < 420) block += "#extension GL_ARB_shading_language_420pack : require\n";
+
+            // 구간마다 uint 4개: [사이클 하위 32비트, 상위 32비트, 지난 invocation 수, 예약]
+            // clock 차이는 32비트로 봄 (구간 하나가 2^32 사이클을 넘지 않는다고 가정)
+            block += "layout(std430, binding = " + std::to_string(kProfileBufferBinding) + ") buffer " +
+                     kProfileBlockName + " { uint " + kProfileArrayName + "[]; };\n"
+                     "void autogl_ProfileAdd(uint region, uvec2 t0) {\n"
+                     "    uint dt = clock2x32ARB().x - t0.x;\n"
+                     "    uint base = region * 4u;\n"
+                     "    uint old = atomicAdd(autogl_Profile[base], dt);\n"
+                     "    if (old > 0xFFFFFFFFu - dt) atomicAdd(autogl_Profile[base + 1u], 1u);\n"
+                     "    atomicAdd(autogl_Profile[base + 2u], 1u);\n"
+                     "}\n"
+                     "#line " + std::to_string(nextLine) + "\n";
+            source.insert(at, block);
+        }
+
+        bool usesProfileBinding(const std::string& source) {
+            for (const SsboBinding& b : ScanSsboBindings(source)) {
+                if (b.binding == static_cast<int>(kProfileBufferBinding)) return true;
+            }
+            return false;
+        }
+    }
+
+    std::vector<std::string> ScanProfileRegions(const ShaderSourceSet& sections) {
+        std::vector<std::string> names;
+        scanSection(sections.fragment, names);
+        scanSection(sections.compute, names);
+        return names;
+    }
+
+    void InjectProfileClocks(ShaderSourceSet& sections, const std::vector<std::string>& regions) {
+        if (regions.empty()) return;
+
+        for (std::string* source : { &sections.fragment, &sections.compute }) {
+            if (source->empty()) continue;
+            if (usesProfileBinding(*source)) {
+                AUTOGL_LOG_WARN("Profile", "SSBO binding " + std::to_string(kProfileBufferBinding) +
+                                           " is used by the shader, stage not profiled");
+                continue;
+            }
+            if (rewriteMarkers(*source, regions)) {
+                injectDeclarations(*source);
+            }
+        }
+    }
+
+} // namespace AutoGL
+
+namespace AutoGL::GL {
+
+    namespace {
+        constexpr std::size_t kWordsPerRegion = 4;
+    }
+
+    void ShaderProfiler::setRegions(const std::vector<std::string>& names) {
+        if (names == names_ && (names.empty() || counters_)) return;
+        release();
+        names_ = names;
+        if (names_.empty()) return;
+
+        const auto bytes = static_cast<GLsizeiptr>(names_.size() * kWordsPerRegion * sizeof(GLuint));
+        glCreateBuffers(1, &counters_);
+        glNamedBufferStorage(counters_, bytes, nullptr, 0);
+        const GLuint zero = 0;
+        glClearNamedBufferData(counters_, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+
+        // GPU가 복사를 끝낸 뒤 fence를 확인하고 바로 읽도록 persistent coherent 매핑
+        constexpr GLbitfield kMap = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers(1, &readback_);
+        glNamedBufferStorage(readback_, bytes, nullptr, kMap);
+        mapped_ = static_cast<const GLuint*>(glMapNamedBufferRange(readback_, 0, bytes, kMap));
+        if (!mapped_) {
+            AUTOGL_LOG_ERROR("Profile", "cannot map profile readback buffer");
+            release();
+        }
+    }
+
+    void ShaderProfiler::bind() const {
+        if (counters_) glBindBufferBase(GL_SHADER_STORAGE_BUFFER, kProfileBufferBinding, counters_);
+    }
+
+    void ShaderProfiler::startReadback() {
+        const auto bytes = static_cast<GLsizeiptr>(names_.size() * kWordsPerRegion * sizeof(GLuint));
+
+        // 셰이더의 atomic 쓰기 → 복사, 그 다음 0으로 지워서 다음 구간을 새로 누적
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+        glCopyNamedBufferSubData(counters_, readback_, 0, 0, bytes);
+        const GLuint zero = 0;
+        glClearNamedBufferData(counters_, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+        fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        copiedFrames_ = frames_;
+        frames_ = 0;
+    }
+
+    void ShaderProfiler::endFrame(int interval) {
+        if (!counters_) return;
+        ++frames_;
+        if (!fence_ && frames_ >= std::max(interval, 1)) startReadback();
+    }
+
+    bool ShaderProfiler::poll(bool wait) {
+        if (!fence_) return false;
+
+        const GLuint64 timeout = wait ? 1000000000ull : 0;
+        const GLenum rc = glClientWaitSync(fence_, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        if (rc == GL_TIMEOUT_EXPIRED || rc == GL_WAIT_FAILED) return false;
+        glDeleteSync(fence_);
+        fence_ = nullptr;
+
+        double totalCycles = 0.0;
+        results_.assign(names_.size(), {});
+        for (std::size_t i = 0; i < names_.size(); ++i) {
+            const GLuint* w = mapped_ + i * kWordsPerRegion;
+            const double cycles = static_cast<double>((static_cast<std::uint64_t>(w[1]) << 32) | w[0]);
+            const double calls  = static_cast<double>(w[2]);
+
+            ShaderProfileRegion& r = results_[i];
+            r.name          = names_[i];
+            r.cyclesPerCall = calls > 0.0 ? cycles / calls : 0.0;
+            r.callsPerFrame = copiedFrames_ > 0 ? calls / copiedFrames_ : calls;
+            r.share         = cycles;
+            totalCycles += cycles;
+        }
+        for (ShaderProfileRegion& r : results_) {
+            r.share = totalCycles > 0.0 ? r.share / totalCycles : 0.0;
+        }
+        return true;
+    }
+
+    bool ShaderProfiler::flush() {
+        if (!counters_) return false;
+        const bool had = poll(true);
+        // 마지막 readback 뒤로 프레임이 없으면 그 결과가 최신 (compute 모드는 endFrame 없이 바로 읽음)
+        if (frames_ == 0 && !results_.empty()) return had;
+        startReadback();
+        return poll(true);
+    }
+
+    void ShaderProfiler::release() {
+        if (fence_) glDeleteSync(fence_);
+        if (readback_) {
+            if (mapped_) glUnmapNamedBuffer(readback_);
+            glDeleteBuffers(1, &readback_);
+        }
+        if (counters_) glDeleteBuffers(1, &counters_);
+        fence_    = nullptr;
+        readback_ = 0;
+        counters_ = 0;
+        mapped_   = nullptr;
+        frames_   = 0;
+        copiedFrames_ = 0;
+        names_.clear();
+        results_.clear();
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,77 @@
+// src/gl_profile.hpp
+#pragma once
+#include <glad/glad.h>
+
+#include <AutoGL/AutoGL.hpp>
+
+#include <string>
+#include <vector>
+
+#include "shader_regex.hpp"
+
+namespace AutoGL {
+
+    // 셰이더 프로파일링 모드도 overdraw heatmap처럼 variant define 하나로 표현
+    // (계측된 프로그램은 variant 캐시에 따로 들어감)
+    constexpr const char* kProfileDefine = "AUTOGL_PROFILE";
+    constexpr const char* kProfileBlockName = "AutoGLProfile";
+    constexpr const char* kProfileArrayName = "autogl_Profile";
+    constexpr GLuint kProfileBufferBinding = 7;
+
+    // fragment/compute 섹션의 `// @profile begin name` ... `// @profile end name` 구간 이름.
+    // 처음 나온 순서대로 번호를 매기고 (같은 이름은 같은 번호), 계측 여부와 무관하게 항상 같은 결과
+    std::vector<std::string> ScanProfileRegions(const ShaderSourceSet& sections);
+
+    // 마커를 clock2x32ARB() 읽기로 바꾸고, 구간마다 invocation이 쓴 사이클과 지난 횟수를
+    // kProfileBufferBinding의 SSBO에 atomicAdd로 누적 (구간 번호는 ScanProfileRegions 순서).
+    // begin과 end는 같은 scope에 있어야 하고, 같은 scope 안에서 같은 구간을 두 번 열 수 없음
+    void InjectProfileClocks(ShaderSourceSet& sections, const std::vector<std::string>& regions);
+
+} // namespace AutoGL
+
+namespace AutoGL::GL {
+
+    // 구간별 누적 SSBO와 비동기 readback.
+    // interval 프레임마다 누적값을 readback 버퍼로 복사하고 0으로 지운 뒤 fence를 걸어 두고,
+    // GPU가 끝낸 다음 poll()에서 결과를 읽음 (렌더 스레드를 막지 않음)
+    class ShaderProfiler {
+    public:
+        ShaderProfiler() = default;
+        ShaderProfiler(const ShaderProfiler&) = delete;
+        ShaderProfiler& operator=(const ShaderProfiler&) = delete;
+
+        // 구간 목록이 바뀌면 누적값과 결과를 버리고 버퍼를 다시 잡음
+        void setRegions(const std::vector<std::string>& names);
+        bool active() const noexcept { return counters_ != 0; }
+
+        // draw/dispatch 전에 호출: 누적 버퍼를 kProfileBufferBinding에 연결
+        void bind() const;
+
+        // 프레임 끝에서 호출. interval 프레임이 지났고 진행 중인 readback이 없으면 복사 시작
+        void endFrame(int interval);
+
+        // 진행 중인 readback이 끝났으면 결과를 갱신하고 true. wait이면 끝날 때까지 기다림
+        bool poll(bool wait = false);
+
+        // interval과 무관하게 지금까지의 누적값을 바로 읽음 (종료 시, compute 모드)
+        bool flush();
+
+        const std::vector<ShaderProfileRegion>& results() const noexcept { return results_; }
+
+        // 소유자가 GL 컨텍스트가 current인 스레드에서 명시적으로 호출
+        void release();
+
+    private:
+        std::vector<std::string> names_;
+        std::vector<ShaderProfileRegion> results_;
+        GLuint counters_ = 0;
+        GLuint readback_ = 0;
+        const GLuint* mapped_ = nullptr;
+        GLsync fence_ = nullptr;
+        int frames_ = 0;            // 마지막 복사 이후 프레임 수
+        int copiedFrames_ = 0;      // 진행 중인 readback이 덮는 프레임 수
+
+        void startReadback();
+    };
+
+} // namespace AutoGL::GL
@@ -0,0 +1,250 @@
+// src/gl_query.cpp
+#include "gl_query.hpp"
+
+#include "gl_ext.hpp"
+
+#include <GLFW/glfw3.h>
+
+#include <numeric>
+
+namespace AutoGL::GL {
+
+    namespace {
+        // PipelineStats 멤버 순서와 같음
+        constexpr GLenum kStatTargets[] = {
+            GL_VERTEX_SHADER_INVOCATIONS,
+            GL_FRAGMENT_SHADER_INVOCATIONS,
+            GL_COMPUTE_SHADER_INVOCATIONS,
+            GL_CLIPPING_INPUT_PRIMITIVES,
+            GL_CLIPPING_OUTPUT_PRIMITIVES,
+        };
+    }
+
+    void GpuTimer::release() {
+        if (!queries_.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(queries_.size()), queries_.data());
+        }
+        queries_.clear();
+        late_.clear();
+        head_ = pending_ = 0;
+        active_ = false;
+    }
+
+    double GpuTimer::readMs(GLuint query) const {
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &ns);
+        return static_cast<double>(ns) / 1.0e6;
+    }
+
+    void GpuTimer::begin() {
+        if (active_) return;
+        if (queries_.empty()) {
+            queries_.resize(depth_);
+            glCreateQueries(GL_TIME_ELAPSED, static_cast<GLsizei>(depth_), queries_.data());
+        }
+
+        // 링이 가득 차면 가장 오래된 결과를 기다려서 비움
+        if (pending_ == depth_) {
+            late_.push_back(readMs(queries_[oldest()]));
+            --pending_;
+        }
+
+        glBeginQuery(GL_TIME_ELAPSED, queries_[head_]);
+        active_ = true;
+    }
+
+    void GpuTimer::end() {
+        if (!active_) return;
+        glEndQuery(GL_TIME_ELAPSED);
+        head_ = (head_ + 1) % depth_;
+        ++pending_;
+        active_ = false;
+    }
+
+    void GpuTimer::collect(std::vector<double>& outMs, bool wait) {
+        outMs.insert(outMs.end(), late_.begin(), late_.end());
+        late_.clear();
+
+        while (pending_ > 0) {
+            const GLuint q = queries_[oldest()];
+            if (!wait) {
+                GLuint available = GL_FALSE;
+                glGetQueryObjectuiv(q, GL_QUERY_RESULT_AVAILABLE, &available);
+                if (!available) break;
+            }
+            outMs.push_back(readMs(q));
+            --pending_;
+        }
+    }
+
+    void PipelineStatsQuery::release() {
+        if (!queries_.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(queries_.size()), queries_.data());
+        }
+        queries_.clear();
+        late_.clear();
+        head_ = pending_ = 0;
+        active_ = false;
+    }
+
+    PipelineStats PipelineStatsQuery::read(std::size_t slot) const {
+        GLuint64 v[kCounters] = {};
+        for (std::size_t j = 0; j < kCounters; ++j) {
+            glGetQueryObjectui64v(queries_[slot * kCounters + j], GL_QUERY_RESULT, &v[j]);
+        }
+
+        PipelineStats s;
+        s.vertexInvocations        = v[0];
+        s.fragmentInvocations      = v[1];
+        s.computeInvocations       = v[2];
+        s.clippingInputPrimitives  = v[3];
+        s.clippingOutputPrimitives = v[4];
+        return s;
+    }
+
+    void PipelineStatsQuery::begin() {
+        if (active_ || !QueryExtensions().pipelineStatistics) return;
+        if (queries_.empty()) {
+            // 일부 드라이버(Mesa)의 glCreateQueries는 통계 target을 거부하므로
+            // 이름만 만들고 첫 glBeginQuery에서 target을 정함
+            queries_.resize(depth_ * kCounters);
+            glGenQueries(static_cast<GLsizei>(queries_.size()), queries_.data());
+        }
+
+        if (pending_ == depth_) {
+            late_.push_back(read(oldest()));
+            --pending_;
+        }
+
+        for (std::size_t j = 0; j < kCounters; ++j) {
+            glBeginQuery(kStatTargets[j], queries_[head_ * kCounters + j]);
+        }
+        active_ = true;
+    }
+
+    void PipelineStatsQuery::end() {
+        if (!active_) return;
+        for (GLenum target : kStatTargets) glEndQuery(target);
+        head_ = (head_ + 1) % depth_;
+        ++pending_;
+        active_ = false;
+    }
+
+    void PipelineStatsQuery::collect(std::vector<PipelineStats>& out, bool wait) {
+        out.insert(out.end(), late_.begin(), late_.end());
+        late_.clear();
+
+        while (pending_ > 0) {
+            const std::size_t slot = oldest();
+            if (!wait) {
+                // 마지막 통계가 준비되면 같은 구간의 나머지도 끝난 것
+                GLuint available = GL_FALSE;
+                glGetQueryObjectuiv(queries_[slot * kCounters + kCounters - 1],
+                                    GL_QUERY_RESULT_AVAILABLE, &available);
+                if (!available) break;
+            }
+            out.push_back(read(slot));
+            --pending_;
+        }
+    }
+
+    PipelineStatistics AveragePipelineStats(const std::vector<PipelineStats>& stats,
+                                            const std::vector<double>& gpuMs) {
+        PipelineStatistics r;
+        if (stats.empty()) return r;
+
+        for (const PipelineStats& s : stats) {
+            r.vertexInvocations        += static_cast<double>(s.vertexInvocations);
+            r.fragmentInvocations      += static_cast<double>(s.fragmentInvocations);
+            r.computeInvocations       += static_cast<double>(s.computeInvocations);
+            r.clippingInputPrimitives  += static_cast<double>(s.clippingInputPrimitives);
+            r.clippingOutputPrimitives += static_cast<double>(s.clippingOutputPrimitives);
+        }
+
+        const double n = static_cast<double>(stats.size());
+        r.samples                  = stats.size();
+        r.vertexInvocations        /= n;
+        r.fragmentInvocations      /= n;
+        r.computeInvocations       /= n;
+        r.clippingInputPrimitives  /= n;
+        r.clippingOutputPrimitives /= n;
+        if (!gpuMs.empty()) {
+            r.gpuMs = std::accumulate(gpuMs.begin(), gpuMs.end(), 0.0) / static_cast<double>(gpuMs.size());
+        }
+        return r;
+    }
+
+    void FramePacer::endFrame(double inputTime) {
+        const bool measure = inputTime > 0.0;
+
+        if (measure || maxInFlight_ > 0) {
+            Frame f;
+            f.inputTime = inputTime;
+
+            if (measure) {
+                if (freeQueries_.empty()) {
+                    GLuint q = 0;
+                    glCreateQueries(GL_TIMESTAMP, 1, &q);
+                    freeQueries_.push_back(q);
+                }
+                f.query = freeQueries_.back();
+                freeQueries_.pop_back();
+                glQueryCounter(f.query, GL_TIMESTAMP);
+
+                // GPU 시계를 CPU 시계(glfwGetTime)로 환산하는 오프셋, 측정할 때마다 다시 맞춤
+                GLint64 gpuNow = 0;
+                glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+                clockOffset_ = glfwGetTime() - static_cast<double>(gpuNow) * 1.0e-9;
+            }
+
+            f.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            frames_.push_back(f);
+        }
+
+        // 제한을 넘는 프레임은 GPU가 끝낼 때까지 기다리고, 나머지는 끝난 것만 정리
+        constexpr GLuint64 kMaxWaitNs = 1000000000ull;
+        while (!frames_.empty()) {
+            const bool over = maxInFlight_ > 0 && static_cast<int>(frames_.size()) > maxInFlight_;
+            const Frame& front = frames_.front();
+
+            const GLenum rc = glClientWaitSync(front.fence, GL_SYNC_FLUSH_COMMANDS_BIT, over ? kMaxWaitNs : 0);
+            if (rc == GL_TIMEOUT_EXPIRED && !over) break;
+
+            retire(front);
+            frames_.pop_front();
+        }
+    }
+
+    void FramePacer::retire(const Frame& f) {
+        glDeleteSync(f.fence);
+        if (!f.query) return;
+
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v(f.query, GL_QUERY_RESULT, &ns);
+        freeQueries_.push_back(f.query);
+
+        const double doneTime = static_cast<double>(ns) * 1.0e-9 + clockOffset_;
+        const double ms = (doneTime - f.inputTime) * 1000.0;
+        if (ms >= 0.0) latencyMs_.push_back(ms);
+    }
+
+    void FramePacer::collect(std::vector<double>& outMs) {
+        outMs.insert(outMs.end(), latencyMs_.begin(), latencyMs_.end());
+        latencyMs_.clear();
+    }
+
+    void FramePacer::release() {
+        for (const Frame& f : frames_) {
+            glDeleteSync(f.fence);
+            if (f.query) freeQueries_.push_back(f.query);
+        }
+        frames_.clear();
+
+        if (!freeQueries_.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(freeQueries_.size()), freeQueries_.data());
+        }
+        freeQueries_.clear();
+        latencyMs_.clear();
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,129 @@
+// src/gl_query.hpp
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <vector>
+#include <glad/glad.h>
+
+#include <AutoGL/AutoGL.hpp>
+
+namespace AutoGL::GL {
+
+    // GL_TIME_ELAPSED 쿼리 링.
+    // 결과는 보통 몇 프레임 늦게 나오므로 collect()는 준비된 것만 가져가고 렌더 스레드를
+    // 막지 않는다. begin()에서 빈 슬롯이 없을 때만 가장 오래된 결과를 기다린다.
+    // TIME_ELAPSED 쿼리는 중첩될 수 없으므로 begin/end 구간끼리 겹치면 안 됨.
+    class GpuTimer {
+    public:
+        explicit GpuTimer(std::size_t depth = 8) : depth_(depth ? depth : 1) {}
+
+        GpuTimer(const GpuTimer&) = delete;
+        GpuTimer& operator=(const GpuTimer&) = delete;
+
+        void begin();
+        void end();
+
+        // 끝난 구간의 GPU 시간(ms)을 out 뒤에 추가. wait이면 남은 구간을 모두 기다림
+        void collect(std::vector<double>& outMs, bool wait = false);
+
+        // 쿼리 객체 삭제. 컨텍스트가 먼저 파괴될 수 있으므로 소멸자 대신
+        // 소유자가 GL 컨텍스트가 current인 스레드에서 명시적으로 호출
+        void release();
+
+    private:
+        std::size_t depth_;
+        std::vector<GLuint> queries_;
+        std::size_t head_    = 0;     // 다음 begin이 쓸 슬롯
+        std::size_t pending_ = 0;     // 결과를 아직 가져가지 않은 구간 수
+        bool active_ = false;
+        std::vector<double> late_;    // begin이 기다려서 미리 읽은 결과
+
+        std::size_t oldest() const noexcept { return (head_ + depth_ - pending_) % depth_; }
+        double readMs(GLuint query) const;
+    };
+
+    // 한 구간(draw 또는 dispatch)의 파이프라인 통계
+    struct PipelineStats {
+        GLuint64 vertexInvocations        = 0;
+        GLuint64 fragmentInvocations      = 0;
+        GLuint64 computeInvocations       = 0;
+        GLuint64 clippingInputPrimitives  = 0;
+        GLuint64 clippingOutputPrimitives = 0;
+    };
+
+    // 파이프라인 통계 쿼리 링 (GpuTimer와 같은 방식, 구간마다 통계 종류별 쿼리 하나씩).
+    // target이 달라서 TIME_ELAPSED 구간과 겹쳐도 되지만 통계 구간끼리는 겹치면 안 됨.
+    // 지원하지 않는 컨텍스트에서는 아무 일도 하지 않고 collect도 비어 있음
+    class PipelineStatsQuery {
+    public:
+        explicit PipelineStatsQuery(std::size_t depth = 8) : depth_(depth ? depth : 1) {}
+
+        PipelineStatsQuery(const PipelineStatsQuery&) = delete;
+        PipelineStatsQuery& operator=(const PipelineStatsQuery&) = delete;
+
+        void begin();
+        void end();
+
+        // 끝난 구간의 통계를 out 뒤에 추가. wait이면 남은 구간을 모두 기다림
+        void collect(std::vector<PipelineStats>& out, bool wait = false);
+
+        // GpuTimer와 같은 이유로 명시적으로 해제
+        void release();
+
+    private:
+        static constexpr std::size_t kCounters = 5;
+
+        std::size_t depth_;
+        std::vector<GLuint> queries_;     // 슬롯 i의 통계 j = queries_[i * kCounters + j]
+        std::size_t head_    = 0;
+        std::size_t pending_ = 0;
+        bool active_ = false;
+        std::vector<PipelineStats> late_;
+
+        std::size_t oldest() const noexcept { return (head_ + depth_ - pending_) % depth_; }
+        PipelineStats read(std::size_t slot) const;
+    };
+
+    // 구간별 통계와 같은 구간들의 GPU 시간(ms)을 평균해서 공개 구조체로
+    PipelineStatistics AveragePipelineStats(const std::vector<PipelineStats>& stats,
+                                            const std::vector<double>& gpuMs);
+
+    // 프레임 끝 fence로 CPU가 GPU보다 앞서 쌓는 프레임 수를 제한하고, 새 입력을 반영한
+    // 프레임은 GL_TIMESTAMP로 GPU가 프레임을 끝낸 시각을 받아 입력→present 지연을 잰다.
+    // (timestamp는 CPU 시계로 환산하므로 결과를 늦게 확인해도 측정값은 밀리지 않음)
+    class FramePacer {
+    public:
+        FramePacer() = default;
+        FramePacer(const FramePacer&) = delete;
+        FramePacer& operator=(const FramePacer&) = delete;
+
+        // 0이면 제한 없음 (지연 측정만), n이면 GPU가 끝내지 않은 프레임을 n개까지만 허용
+        void setMaxFramesInFlight(int n) { maxInFlight_ = n > 0 ? n : 0; }
+
+        // swap 직후 호출. inputTime(glfwGetTime 기준 초) > 0 이면 이 프레임이 반영한
+        // 입력의 발생 시각으로 지연을 측정
+        void endFrame(double inputTime);
+
+        // 측정이 끝난 지연(ms)을 out 뒤에 추가
+        void collect(std::vector<double>& outMs);
+
+        // GpuTimer와 같은 이유로 명시적으로 해제
+        void release();
+
+    private:
+        struct Frame {
+            GLsync fence = nullptr;
+            GLuint query = 0;           // GL_TIMESTAMP, 측정 대상이 아니면 0
+            double inputTime = 0.0;
+        };
+
+        std::deque<Frame> frames_;
+        std::vector<GLuint> freeQueries_;
+        std::vector<double> latencyMs_;
+        double clockOffset_ = 0.0;      // CPU 시각 - GPU timestamp (초)
+        int maxInFlight_ = 0;
+
+        void retire(const Frame& f);
+    };
+
+} // namespace AutoGL::GL
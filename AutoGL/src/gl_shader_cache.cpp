@@ -0,0 +1,91 @@
+// src/gl_shader_cache.cpp
+#include "gl_shader_cache.hpp"
+#include "hash_util.hpp"
+
+namespace AutoGL::GL {
+
+    std::uint64_t StageProgramCache::hashSource(ShaderStage stage, const std::string& source) {
+        const auto tag = static_cast<std::uint32_t>(stage);
+        return Fnv1a64(source, Fnv1a64(&tag, sizeof(tag)));
+    }
+
+    GLuint StageProgramCache::acquire(std::uint64_t hash) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = entries_.find(hash);
+        if (it == entries_.end()) return 0;
+
+        ++it->second.refs;
+        it->second.lastUse = ++useCounter_;
+        return it->second.program;
+    }
+
+    GLuint StageProgramCache::insert(std::uint64_t hash, GLuint program) {
+        if (!program) return 0;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = entries_.find(hash);
+        if (it != entries_.end()) {
+            glDeleteProgram(program);
+            ++it->second.refs;
+            it->second.lastUse = ++useCounter_;
+            return it->second.program;
+        }
+
+        entries_[hash] = Entry{ program, 1, ++useCounter_ };
+        byProgram_[program] = hash;
+        trimLocked();
+        return program;
+    }
+
+    void StageProgramCache::retain(GLuint program) {
+        if (!program) return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto p = byProgram_.find(program);
+        if (p == byProgram_.end()) return;
+
+        Entry& e = entries_[p->second];
+        ++e.refs;
+        e.lastUse = ++useCounter_;
+    }
+
+    void StageProgramCache::release(GLuint program) {
+        if (!program) return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto p = byProgram_.find(program);
+        if (p == byProgram_.end()) return;
+
+        Entry& e = entries_[p->second];
+        if (e.refs > 0) --e.refs;
+        trimLocked();
+    }
+
+    void StageProgramCache::trimLocked() {
+        while (entries_.size() > capacity_) {
+            auto oldest = entries_.end();
+            for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+                if (it->second.refs > 0) continue;
+                if (oldest == entries_.end() || it->second.lastUse < oldest->second.lastUse) oldest = it;
+            }
+            // 전부 사용 중이면 capacity를 잠시 넘겨도 삭제하지 않음
+            if (oldest == entries_.end()) return;
+
+            glDeleteProgram(oldest->second.program);
+            byProgram_.erase(oldest->second.program);
+            entries_.erase(oldest);
+        }
+    }
+
+    void StageProgramCache::clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [hash, e] : entries_) {
+            glDeleteProgram(e.program);
+        }
+        entries_.clear();
+        byProgram_.clear();
+    }
+
+} // namespace AutoGL::GL
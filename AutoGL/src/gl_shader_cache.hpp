@@ -0,0 +1,59 @@
+// src/gl_shader_cache.hpp
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <glad/glad.h>
+
+#include "gl_shader_common.hpp"
+
+namespace AutoGL::GL {
+
+    // GL_PROGRAM_SEPARABLE stage 프로그램을 (stage, 소스 해시)로 보관.
+    // 바뀌지 않은 stage는 다시 컴파일/링크하지 않고, 같은 fullscreen vertex stage는
+    // 세션의 모든 셰이더가 하나를 공유한다. 프로그램 객체는 공유 컨텍스트끼리
+    // 공유되므로 워커에서 넣고 렌더 스레드에서 pipeline에 붙여도 된다.
+    //
+    // pipeline에 붙어 있는 동안 삭제되면 안 되므로 참조 카운트로 관리하고,
+    // 참조가 0이 된 항목은 바로 지우지 않고 capacity까지 보관했다가 오래된 것부터 삭제.
+    class StageProgramCache {
+    public:
+        explicit StageProgramCache(std::size_t capacity = 64) : capacity_(capacity) {}
+
+        StageProgramCache(const StageProgramCache&) = delete;
+        StageProgramCache& operator=(const StageProgramCache&) = delete;
+
+        static std::uint64_t hashSource(ShaderStage stage, const std::string& source);
+
+        // 있으면 참조 +1 후 반환, 없으면 0
+        GLuint acquire(std::uint64_t hash);
+
+        // 새로 링크한 stage 프로그램 등록 (참조 1)
+        // 다른 워커가 같은 소스를 먼저 등록했으면 넘긴 프로그램은 삭제하고 기존 것을 반환
+        GLuint insert(std::uint64_t hash, GLuint program);
+
+        // 이미 가진 프로그램에 대한 참조 추가/해제 (캐시에 없는 이름은 무시)
+        void retain(GLuint program);
+        void release(GLuint program);
+
+        // GL 컨텍스트가 current인 스레드에서 호출
+        void clear();
+
+    private:
+        struct Entry {
+            GLuint program = 0;
+            int refs = 0;
+            std::uint64_t lastUse = 0;
+        };
+
+        std::mutex mutex_;
+        std::unordered_map<std::uint64_t, Entry> entries_;
+        std::unordered_map<GLuint, std::uint64_t> byProgram_;
+        std::uint64_t useCounter_ = 0;
+        std::size_t capacity_;
+
+        void trimLocked();
+    };
+
+} // namespace AutoGL::GL
@@ -16,9 +16,7 @@ namespace AutoGL::GL {
         }
     }
 
-    GLuint CompileShaderSource(ShaderStage stage,
-                               const std::string& source,
-                               const char* debugName) {
+    GLuint SubmitShaderSource(ShaderStage stage, const std::string& source) {
         const GLenum glType = toGLenum(stage);
         GLuint shader = glCreateShader(glType);
         if (!shader) {
@@ -29,6 +27,11 @@ namespace AutoGL::GL {
         const char* src = source.c_str();
         glShaderSource(shader, 1, &src, nullptr);
         glCompileShader(shader);
+        return shader;
+    }
+
+    bool FinishShaderCompile(GLuint shader, const char* debugName) {
+        if (!shader) return false;
 
         GLint success = 0;
         glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
@@ -39,9 +42,19 @@ namespace AutoGL::GL {
                 std::string("Shader compile failed in ")
                 + (debugName ? debugName : "unknown") + ": " + log);
             glDeleteShader(shader);
-            return 0;
+            return false;
         }
 
+        return true;
+    }
+
+    GLuint CompileShaderSource(ShaderStage stage,
+                               const std::string& source,
+                               const char* debugName) {
+        GLuint shader = SubmitShaderSource(stage, source);
+        if (!FinishShaderCompile(shader, debugName)) {
+            return 0;
+        }
         return shader;
     }
 
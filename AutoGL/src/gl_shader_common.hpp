@@ -11,7 +11,15 @@ namespace AutoGL::GL {
         Compute
     };
 
-    // 공통 컴파일 함수
+    // 컴파일 요청만 하고 결과는 확인하지 않음.
+    // parallel_shader_compile이 켜져 있으면 여러 셰이더를 먼저 제출한 뒤
+    // FinishShaderCompile로 확인해야 드라이버가 병렬로 컴파일할 수 있다.
+    GLuint SubmitShaderSource(ShaderStage stage, const std::string& source);
+
+    // 컴파일 결과 확인, 실패 시 로그 출력 후 셰이더 삭제하고 false
+    bool FinishShaderCompile(GLuint shader, const char* debugName);
+
+    // 공통 컴파일 함수 (Submit + Finish)
     GLuint CompileShaderSource(
         ShaderStage stage,
         const std::string& source,
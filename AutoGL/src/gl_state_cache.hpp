@@ -0,0 +1,88 @@
+// src/gl_state_cache.hpp
+#pragma once
+#include <glad/glad.h>
+
+namespace AutoGL {
+
+    // 마지막으로 설정한 바인딩 상태를 기억하고, 값이 같으면 GL 호출을 건너뛴다.
+    // 리소스 생성은 DSA(glCreate*/glNamed*)로 처리하므로 이 캐시 밖에서
+    // 바인딩이 바뀌는 경우는 없어야 한다.
+    class GLStateCache {
+    public:
+        void useProgram(GLuint program) {
+            if (program_ == program) return;
+            glUseProgram(program);
+            program_ = program;
+        }
+
+        // 0이 아닌 program이 바인딩돼 있으면 pipeline보다 우선하므로,
+        // pipeline으로 그릴 때는 useProgram(0)을 먼저 호출해야 한다
+        void bindProgramPipeline(GLuint pipeline) {
+            if (pipeline_ == pipeline) return;
+            glBindProgramPipeline(pipeline);
+            pipeline_ = pipeline;
+        }
+
+        // GL_FRAMEBUFFER (draw + read) 바인딩
+        void bindFramebuffer(GLuint fbo) {
+            if (fbo_ == fbo) return;
+            glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+            fbo_ = fbo;
+        }
+
+        void bindVertexArray(GLuint vao) {
+            if (vao_ == vao) return;
+            glBindVertexArray(vao);
+            vao_ = vao;
+        }
+
+        void viewport(GLint x, GLint y, GLsizei w, GLsizei h) {
+            if (viewport_[0] == x && viewport_[1] == y &&
+                viewport_[2] == w && viewport_[3] == h) {
+                return;
+            }
+            glViewport(x, y, w, h);
+            viewport_[0] = x;
+            viewport_[1] = y;
+            viewport_[2] = w;
+            viewport_[3] = h;
+        }
+
+        // glDeleteProgram 직전에 호출 (삭제된 이름이 재사용될 수 있으므로)
+        void forgetProgram(GLuint program) {
+            if (program_ == program) program_ = kUnknown;
+        }
+
+        void forgetProgramPipeline(GLuint pipeline) {
+            if (pipeline_ == pipeline) pipeline_ = kUnknown;
+        }
+
+        void forgetFramebuffer(GLuint fbo) {
+            if (fbo_ == fbo) fbo_ = kUnknown;
+        }
+
+        void forgetVertexArray(GLuint vao) {
+            if (vao_ == vao) vao_ = kUnknown;
+        }
+
+        // 외부 코드가 GL 상태를 직접 건드렸을 때 전체 무효화
+        void invalidate() {
+            program_  = kUnknown;
+            pipeline_ = kUnknown;
+            fbo_      = kUnknown;
+            vao_      = kUnknown;
+            viewport_[0] = viewport_[1] = -1;
+            viewport_[2] = viewport_[3] = -1;
+        }
+
+    private:
+        static constexpr GLuint kUnknown = 0xFFFFFFFFu;
+
+        GLuint program_  = kUnknown;
+        GLuint pipeline_ = kUnknown;
+        GLuint fbo_      = kUnknown;
+        GLuint vao_      = kUnknown;
+        GLint  viewport_[4] = {-1, -1, -1, -1};
+    };
+
+} // namespace AutoGL
@@ -0,0 +1,136 @@
+// src/gl_user_uniforms.cpp
+#include "gl_user_uniforms.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace AutoGL::GL {
+
+    namespace {
+        int componentsOf(GLenum type) {
+            switch (type) {
+            case GL_FLOAT: case GL_INT: case GL_UNSIGNED_INT: case GL_BOOL:
+                return 1;
+            case GL_FLOAT_VEC2: case GL_INT_VEC2: case GL_UNSIGNED_INT_VEC2: case GL_BOOL_VEC2:
+                return 2;
+            case GL_FLOAT_VEC3: case GL_INT_VEC3: case GL_UNSIGNED_INT_VEC3: case GL_BOOL_VEC3:
+                return 3;
+            case GL_FLOAT_VEC4: case GL_INT_VEC4: case GL_UNSIGNED_INT_VEC4: case GL_BOOL_VEC4:
+                return 4;
+            default:
+                return 0;   // 행렬, sampler 등은 setUniform 대상이 아님
+            }
+        }
+
+        // 성분 수가 모자라면 0으로 채워서 선언 타입대로 씀.
+        // int는 GLSL int()와 같이 버림, bool은 0이 아니면 true (특수화된 상수와 같은 값)
+        void write(GLuint program, GLint location, GLenum type, const std::vector<float>& value) {
+            const int n = componentsOf(type);
+            if (n == 0) return;
+
+            float f[4] = {};
+            std::copy_n(value.begin(), std::min<std::size_t>(value.size(), 4), f);
+
+            switch (type) {
+            case GL_FLOAT: case GL_FLOAT_VEC2: case GL_FLOAT_VEC3: case GL_FLOAT_VEC4: {
+                if (n == 1)      glProgramUniform1fv(program, location, 1, f);
+                else if (n == 2) glProgramUniform2fv(program, location, 1, f);
+                else if (n == 3) glProgramUniform3fv(program, location, 1, f);
+                else             glProgramUniform4fv(program, location, 1, f);
+                break;
+            }
+            case GL_UNSIGNED_INT: case GL_UNSIGNED_INT_VEC2:
+            case GL_UNSIGNED_INT_VEC3: case GL_UNSIGNED_INT_VEC4: {
+                GLuint u[4];
+                for (int i = 0; i < 4; ++i) u[i] = static_cast<GLuint>(std::max(f[i], 0.0f));
+                if (n == 1)      glProgramUniform1uiv(program, location, 1, u);
+                else if (n == 2) glProgramUniform2uiv(program, location, 1, u);
+                else if (n == 3) glProgramUniform3uiv(program, location, 1, u);
+                else             glProgramUniform4uiv(program, location, 1, u);
+                break;
+            }
+            default: {
+                const bool isBool = type == GL_BOOL || type == GL_BOOL_VEC2 ||
+                                    type == GL_BOOL_VEC3 || type == GL_BOOL_VEC4;
+                GLint v[4];
+                for (int i = 0; i < 4; ++i) v[i] = isBool ? (f[i] != 0.0f) : static_cast<GLint>(f[i]);
+                if (n == 1)      glProgramUniform1iv(program, location, 1, v);
+                else if (n == 2) glProgramUniform2iv(program, location, 1, v);
+                else if (n == 3) glProgramUniform3iv(program, location, 1, v);
+                else             glProgramUniform4iv(program, location, 1, v);
+                break;
+            }
+            }
+        }
+    }
+
+    bool UserUniforms::set(const std::string& name, const std::vector<float>& value) {
+        Entry& e = entries_[name];
+        if (e.value == value && !value.empty()) return false;
+        e.value = value;
+        e.stableFrames = 0;
+        return true;
+    }
+
+    UserUniforms::Location UserUniforms::find(GLuint program, const std::string& name) {
+        auto& perProgram = locations_[program];
+        auto it = perProgram.find(name);
+        if (it != perProgram.end()) return it->second;
+
+        Location loc;
+        const GLuint index = glGetProgramResourceIndex(program, GL_UNIFORM, name.c_str());
+        if (index != GL_INVALID_INDEX) {
+            const GLenum props[2] = { GL_LOCATION, GL_TYPE };
+            GLint values[2] = { -1, 0 };
+            glGetProgramResourceiv(program, GL_UNIFORM, index, 2, props, 2, nullptr, values);
+            loc.location = values[0];
+            loc.type     = static_cast<GLenum>(values[1]);
+        }
+        perProgram.emplace(name, loc);
+        return loc;
+    }
+
+    void UserUniforms::upload(const GraphicsStages& stages) {
+        // 삭제된 프로그램 이름이 재사용될 수 있으므로 stage 조합이 바뀌면 위치를 다시 조회
+        if (stages != cachedStages_) {
+            locations_.clear();
+            cachedStages_ = stages;
+        }
+
+        for (auto& [name, e] : entries_) {
+            e.active = false;
+            for (GLuint program : { stages.vertex, stages.fragment, stages.compute }) {
+                if (!program) continue;
+                const Location loc = find(program, name);
+                if (loc.location < 0) continue;
+
+                e.active     = true;
+                e.components = componentsOf(loc.type);
+                write(program, loc.location, loc.type, e.value);
+            }
+        }
+    }
+
+    bool UserUniforms::advanceFrame(int threshold) {
+        bool reached = false;
+        for (auto& [name, e] : entries_) {
+            if (!e.active || e.specialized) continue;
+            if (++e.stableFrames == threshold) reached = true;
+        }
+        return reached;
+    }
+
+    std::string UserUniforms::FormatConstant(const Entry& e) {
+        const std::size_t n = e.components > 0 ? static_cast<std::size_t>(e.components) : e.value.size();
+
+        std::string out;
+        for (std::size_t i = 0; i < n; ++i) {
+            char buf[32];
+            std::snprintf(buf, sizeof(buf), "%.9g", i < e.value.size() ? e.value[i] : 0.0f);
+            if (i) out += ", ";
+            out += buf;
+        }
+        return out;
+    }
+
+} // namespace AutoGL::GL
@@ -0,0 +1,53 @@
+// src/gl_user_uniforms.hpp
+#pragma once
+#include <glad/glad.h>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "glsl_loader.hpp"
+
+namespace AutoGL::GL {
+
+    // setUniform으로 받은 사용자 uniform (렌더 스레드 전용).
+    // 매 프레임 stage 프로그램에 올리고, 값이 그대로인 프레임 수를 세서 특수화 대상을 고름
+    class UserUniforms {
+    public:
+        struct Entry {
+            std::vector<float> value;
+            int  components  = 0;       // 셰이더 선언의 성분 수 (reflection 전이면 0)
+            int  stableFrames = 0;      // 값이 바뀌지 않고 그린 프레임 수
+            bool active      = false;   // 현재 프로그램에 uniform으로 존재
+            bool specialized = false;   // 현재 variant 선택에 const로 들어가 있음
+        };
+
+        // 값이 바뀌었으면 true (안정 프레임 수는 0부터 다시)
+        bool set(const std::string& name, const std::vector<float>& value);
+
+        // 각 stage에 같은 이름의 uniform이 있으면 모두 씀. const로 특수화되어 없어진 uniform은 건너뜀
+        void upload(const GraphicsStages& stages);
+
+        // 그린 프레임마다 호출: 안정 프레임 수 증가, threshold에 막 닿은 uniform이 있으면 true
+        bool advanceFrame(int threshold);
+
+        // 특수화 define 값: 선언 성분 수에 맞춰 0으로 채운 "v0, v1, ..." (정확히 같은 float로 돌아오는 자릿수)
+        static std::string FormatConstant(const Entry& e);
+
+        std::map<std::string, Entry>& entries() noexcept { return entries_; }
+
+    private:
+        struct Location {
+            GLint  location = -1;
+            GLenum type     = 0;
+        };
+
+        std::map<std::string, Entry> entries_;
+        GraphicsStages cachedStages_;
+        std::unordered_map<GLuint, std::unordered_map<std::string, Location>> locations_;
+
+        Location find(GLuint program, const std::string& name);
+    };
+
+} // namespace AutoGL::GL
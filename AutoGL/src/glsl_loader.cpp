@@ -5,21 +5,44 @@
 #include "gl_shader_vertex.hpp"
 #include "gl_shader_fragment.hpp"
 #include "gl_shader_compute.hpp"
+#include "gl_shader_common.hpp"
+#include "program_binary_cache.hpp"
+#include "shader_preprocessor.hpp"
+#include "gl_shader_cache.hpp"
+#include "hash_util.hpp"
+#include "gl_late_latch.hpp"
+#include "gl_overdraw.hpp"
+#include "gl_profile.hpp"
 
 #include <AutoGL/Log.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <vector>
 
 namespace AutoGL::detail {
 
+    using BuildClock = std::chrono::steady_clock;
+
+    static double elapsedMs(BuildClock::time_point since) {
+        return std::chrono::duration<double, std::milli>(BuildClock::now() - since).count();
+    }
+
+    // DSA로 생성하므로 GL_SHADER_STORAGE_BUFFER 바인딩이 바뀌지 않음
+    // (DumpAllSSBOs에서 읽을 수 있도록 MAP_READ 허용)
     static unsigned int createTypedSSBO(std::size_t count, std::size_t elemSize) {
         GLuint ssbo = 0;
-        glGenBuffers(1, &ssbo);
-        glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
-        glBufferData(GL_SHADER_STORAGE_BUFFER, count * elemSize, nullptr, GL_DYNAMIC_DRAW);
-        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        glCreateBuffers(1, &ssbo);
+        glNamedBufferStorage(
+            ssbo,
+            static_cast<GLsizeiptr>(count * elemSize),
+            nullptr,
+            GL_DYNAMIC_STORAGE_BIT | GL_MAP_READ_BIT
+        );
         return ssbo;
     }
 
@@ -63,6 +86,8 @@ namespace AutoGL::detail {
             );
 
             if (binding < 0) continue;
+            // 프로파일링 누적 버퍼는 엔진이 직접 연결 (덤프 대상도 아님)
+            if (std::string(nameBuf, static_cast<std::size_t>(len)) == kProfileBlockName) continue;
 
             // 이름 기반으로 타입 추론 시도
             SSBOTypeInfo tinfo;
@@ -79,37 +104,197 @@ namespace AutoGL::detail {
             // stride가 0이면 fallback
             if (tinfo.stride <= 0) tinfo.stride = 4;
 
-            // 이미 생성된 SSBO가 있는지 검사
-            GLint currentSSBO = 0;
-            glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING, binding, &currentSSBO);
+            // 저장 (버퍼 할당은 bindComputeSSBOs에서)
+            out[binding] = tinfo;
+        }
+    }
+
+    // binding마다 1024개 요소 크기의 SSBO를 새로 만들어 연결.
+    // 앞 셰이더가 남긴 버퍼는 stride가 다를 수 있으므로 재사용하지 않고 지운다
+    static void bindComputeSSBOs(const std::unordered_map<int, SSBOTypeInfo>& infos) {
+        for (const auto& [binding, tinfo] : infos) {
+            GLint previous = 0;
+            glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING, static_cast<GLuint>(binding), &previous);
+            if (previous != 0) {
+                const GLuint buffer = static_cast<GLuint>(previous);
+                glDeleteBuffers(1, &buffer);
+            }
+
+            GLuint ssbo = createTypedSSBO(1024, static_cast<std::size_t>(tinfo.stride));
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, static_cast<GLuint>(binding), ssbo);
+        }
+    }
+
 
-            if (currentSSBO == 0) {
-                GLuint ssbo = 0;
-                glGenBuffers(1, &ssbo);
-                glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+    // 섹션별 해시를 이어 붙임 (@variant 선언도 포함해야 선언만 바뀐 경우를 잡음)
+    static std::uint64_t hashSections(const ShaderSourceSet& s, const std::vector<VariantDecl>& decls,
+                                      int instanceCount, const std::string& meshPath,
+                                      const IndirectDrawInfo& indirect) {
+        std::uint64_t h = kFnvOffset;
+        if (instanceCount > 0) h = HashAppend(h, "@instances " + std::to_string(instanceCount));
+        if (!meshPath.empty())  h = HashAppend(h, "@mesh " + meshPath);
+        if (indirect.enabled()) {
+            h = HashAppend(h, "@indirect " + std::to_string(indirect.binding) + " " +
+                              std::to_string(indirect.maxDraws));
+        }
+        h = HashAppend(h, s.vertex);
+        h = HashAppend(h, s.fragment);
+        h = HashAppend(h, s.compute);
+        for (const auto& d : decls) {
+            h = HashAppend(h, d.name);
+            for (const auto& v : d.values) h = HashAppend(h, v);
+        }
+        return h;
+    }
 
-                // 1024개의 요소를 담는 버퍼 생성
-                std::size_t totalBytes = static_cast<std::size_t>(1024) * tinfo.stride;
+    // @mesh 경로는 셰이더 파일 위치 기준, 감시/캐시 키와 맞도록 절대 경로로 정규화
+    static std::string resolveMeshPath(const std::string& shaderPath, const std::string& mesh) {
+        if (mesh.empty()) return {};
 
-                glBufferData(
-                    GL_SHADER_STORAGE_BUFFER,
-                    totalBytes,
-                    nullptr,           // 초기 데이터 없음 (zero-initialized)
-                    GL_DYNAMIC_DRAW
-                );
+        namespace fs = std::filesystem;
+        fs::path p(mesh);
+        if (p.is_relative()) p = fs::path(shaderPath).parent_path() / p;
 
-                // 다시 바인딩 해제
-                glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        std::error_code ec;
+        fs::path abs = fs::absolute(p, ec);
+        return (ec ? p : abs).lexically_normal().string();
+    }
 
-                // binding 슬롯에 연결
-                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, ssbo);
+    // 파일에 @type vertex가 없을 때 쓰는 fullscreen quad vertex stage.
+    // 소스가 항상 같으므로 stage 캐시에서 세션 전체가 하나를 공유한다.
+    // separable 프로그램은 gl_PerVertex를 재선언해야 파이프라인 인터페이스가 맞음 (core 4.5 규칙)
+    static const char* kDefaultVertexStage = R"(#version 450 core
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in vec2 aUV;
+
+out gl_PerVertex { vec4 gl_Position; };
+out vec2 vUV;
+
+void main() {
+    vUV = aUV;
+    gl_Position = vec4(aPos, 0.0, 1.0);
+}
+)";
+
+    // 사용자 @type vertex에 gl_PerVertex 재선언이 없으면 #version/#extension 뒤에 넣음.
+    // 셰이더가 쓰는 내장 출력만 멤버로 두고, #line으로 원래 줄 번호를 유지한다.
+    static void redeclarePerVertex(std::string& section) {
+        if (section.empty() || section.find("gl_PerVertex") != std::string::npos) return;
+
+        const std::size_t ver = section.find("#version");
+        if (ver == std::string::npos || std::strtol(section.c_str() + ver + 8, nullptr, 10) < 150) return;
+
+        std::size_t insertAt = 0;
+        int nextLine = 1;
+        int line = 0;
+        for (std::size_t b = 0; b < section.size();) {
+            std::size_t e = section.find('\n', b);
+            if (e == std::string::npos) e = section.size();
+            ++line;
+
+            std::size_t c = section.find_first_not_of(" \t", b);
+            if (c < e && section[c] == '#') {
+                c = section.find_first_not_of(" \t", c + 1);
+                if (c < e && (section.compare(c, 7, "version") == 0 || section.compare(c, 9, "extension") == 0)) {
+                    insertAt = std::min(e + 1, section.size());
+                    nextLine = line + 1;
+                }
             }
+            b = e + 1;
+        }
 
-            // 저장
-            out[binding] = tinfo;
+        std::string block;
+        if (insertAt == section.size() && section.back() != '\n') block += '\n';
+        block += "out gl_PerVertex {\n    vec4 gl_Position;\n";
+        if (section.find("gl_PointSize") != std::string::npos)    block += "    float gl_PointSize;\n";
+        if (section.find("gl_ClipDistance") != std::string::npos) block += "    float gl_ClipDistance[];\n";
+        if (section.find("gl_CullDistance") != std::string::npos) block += "    float gl_CullDistance[];\n";
+        block += "};\n#line " + std::to_string(nextLine) + "\n";
+        section.insert(insertAt, block);
+    }
+
+    // separable stage 프로그램 하나를 빌드하는 중간 상태
+    struct StageBuild {
+        GL::ShaderStage stage;
+        const char* name = "";
+        const std::string* source = nullptr;
+        std::uint64_t hash = 0;
+        std::uint64_t binaryKey = 0;
+        GLuint shader = 0;
+        GLuint program = 0;
+        bool reused = false;        // stage 캐시에서 가져옴 (컴파일/바이너리 로드 없음)
+        bool cacheHit = false;      // 바이너리 캐시에서 로드
+        double compileMs = 0.0;
+        double linkMs    = 0.0;
+    };
+
+    // 1단계: stage 캐시 → 바이너리 캐시 → 컴파일 제출 순으로 시도
+    // (모든 stage를 먼저 제출해야 parallel_shader_compile 드라이버가 동시에 컴파일)
+    static void beginStage(StageBuild& sb, GL::StageProgramCache* cache, bool useBinaryCache) {
+        if (cache) {
+            sb.hash = GL::StageProgramCache::hashSource(sb.stage, *sb.source);
+            sb.program = cache->acquire(sb.hash);
+            sb.reused  = sb.program != 0;
+            if (sb.reused) return;
         }
+
+        if (useBinaryCache) {
+            sb.binaryKey = MakeProgramCacheKey(std::string("@separable ") + sb.name + "\n" + *sb.source);
+
+            std::unordered_map<int, SSBOTypeInfo> unused;
+            if ((sb.program = LoadCachedProgram(sb.binaryKey, unused, true)) != 0) {
+                if (cache) sb.program = cache->insert(sb.hash, sb.program);
+                sb.cacheHit = true;
+                return;
+            }
+        }
+
+        const auto t0 = BuildClock::now();
+        sb.shader = GL::SubmitShaderSource(sb.stage, *sb.source);
+        sb.compileMs += elapsedMs(t0);
     }
 
+    // 2단계: 컴파일 확인 후 단독 stage 프로그램으로 링크
+    static bool finishStage(StageBuild& sb, GL::StageProgramCache* cache, bool useBinaryCache) {
+        if (sb.program) return true;
+
+        auto t0 = BuildClock::now();
+        const bool compiled = GL::FinishShaderCompile(sb.shader, sb.name);
+        sb.compileMs += elapsedMs(t0);
+        if (!compiled) return false;
+
+        t0 = BuildClock::now();
+        GLuint program = glCreateProgram();
+        glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        if (useBinaryCache) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+        glAttachShader(program, sb.shader);
+        glLinkProgram(program);
+        glDetachShader(program, sb.shader);
+        glDeleteShader(sb.shader);
+        sb.shader = 0;
+
+        GLint ok = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &ok);
+        sb.linkMs += elapsedMs(t0);
+        if (!ok) {
+            char log[2048];
+            glGetProgramInfoLog(program, 2048, nullptr, log);
+            AUTOGL_LOG_ERROR("GraphicLink", std::string(sb.name) + ": " + log);
+            glDeleteProgram(program);
+            return false;
+        }
+
+        if (useBinaryCache) StoreCachedProgram(sb.binaryKey, program, {});
+        sb.program = cache ? cache->insert(sb.hash, program) : program;
+        return true;
+    }
+
+    static void releaseStageProgram(GL::StageProgramCache* cache, GLuint program) {
+        if (!program) return;
+        if (cache) cache->release(program);
+        else       glDeleteProgram(program);
+    }
 
 } // namespace AutoGL::detail
 
@@ -140,63 +325,131 @@ namespace AutoGL {
         }
     }
 
-    // compute용 SSBO auto 생성
-    static unsigned int createEmptySSBO(std::size_t size) {
-        unsigned int ssbo = 0;
-        glGenBuffers(1, &ssbo);
-        glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
-        glBufferData(GL_SHADER_STORAGE_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
-        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
-        return ssbo;
+    std::uint64_t hashShaderFile(const std::string& path, ShaderPreprocessor* preprocessor) {
+        ShaderPreprocessor local;
+        ShaderPreprocessor& pp = preprocessor ? *preprocessor : local;
+
+        ShaderPreprocessor::Result pre = pp.preprocess(path);
+        if (!pre.ok) return 0;
+
+        std::vector<VariantDecl> decls = ExtractVariantDecls(pre.source);
+        const int instances = ExtractInstanceCount(pre.source);
+        const std::string mesh = AutoGL::detail::resolveMeshPath(path, ExtractMeshPath(pre.source));
+        const IndirectDrawInfo indirect = ExtractIndirectDraw(pre.source);
+        return AutoGL::detail::hashSections(ExtractShaderSections(pre.source), decls, instances,
+                                            mesh, indirect);
     }
 
-    LoadedShaderProgram loadShaderProgram(const std::string& path) {
+    LoadedShaderProgram loadShaderProgram(const std::string& path,
+                                          ShaderPreprocessor* preprocessor,
+                                          const VariantSelection* variant,
+                                          GL::StageProgramCache* stageCache) {
         LoadedShaderProgram result;
 
-        std::string full = loadFileSource(path);
-        if (full.empty()) {
+        ShaderPreprocessor local;
+        ShaderPreprocessor& pp = preprocessor ? *preprocessor : local;
+
+        const auto tPre = AutoGL::detail::BuildClock::now();
+        ShaderPreprocessor::Result pre = pp.preprocess(path);
+        result.sourceFiles = std::move(pre.files);
+        if (!pre.ok || pre.source.empty()) {
             return result;
         }
 
-        ShaderSourceSet sections = ExtractShaderSections(full);
+        const VariantSelection selection = variant ? *variant : VariantSelection{};
+        result.variants   = ExtractVariantDecls(pre.source);
+        result.variantKey = MakeVariantKey(result.variants, selection);
+        result.instanceCount = ExtractInstanceCount(pre.source);
+        result.meshPath = AutoGL::detail::resolveMeshPath(path, ExtractMeshPath(pre.source));
+        if (!result.meshPath.empty()) {
+            // 메시 파일도 hot reload 감시 대상 (include 그래프에는 없으므로 셰이더는 다시 빌드하지 않음)
+            result.sourceFiles.push_back(result.meshPath);
+        }
+        result.indirect = ExtractIndirectDraw(pre.source);
+
+        ShaderSourceSet sections = ExtractShaderSections(pre.source);
         if (sections.fragment.empty() && sections.compute.empty() && sections.vertex.empty()) {
             AUTOGL_LOG_ERROR("GLSLLoader",
                 " shader file must contain at least one @type");
             return result;
         }
 
+        result.profileRegions = ScanProfileRegions(sections);
+
         const bool hasVert    = !sections.vertex.empty();
         const bool hasFrag    = !sections.fragment.empty();
         const bool hasCompute = !sections.compute.empty();
 
-        // compute + vertex/fragment 혼합 금지
-        if (hasCompute && (hasVert || hasFrag)) {
-            AUTOGL_LOG_ERROR("GLSLLoader",
-                "@type compute cannot be mixed with vertex/fragment");
-            return result;
+        // compute만 있으면 한 번 dispatch하는 compute 모드,
+        // vertex/fragment와 같이 있으면 그래픽 stage로 빌드해서 매 프레임 draw 전에 dispatch
+        const bool computeOnly = hasCompute && !hasVert && !hasFrag;
+
+        result.isCompute  = computeOnly;
+        result.sourceHash = AutoGL::detail::hashSections(sections, result.variants, result.instanceCount,
+                                                         result.meshPath, result.indirect);
+        if (computeOnly && (!result.meshPath.empty() || result.indirect.enabled())) {
+            AUTOGL_LOG_WARN("GLSLLoader", "@mesh/@indirect are ignored for compute-only shaders");
         }
 
-        GLuint program = glCreateProgram();
-        if (!program) {
-            AUTOGL_LOG_ERROR("GLSLLoader", "glCreateProgram failed");
-            return result;
+        if (hasVert) AutoGL::detail::redeclarePerVertex(sections.vertex);
+        InjectVariantDefines(sections, result.variants, selection);
+        SpecializeUniforms(sections, selection);
+        if (LateLatchInputEnabled() && !computeOnly) {
+            RewriteLateLatchInput(sections);
         }
+        if (selection.count(kOverdrawDefine) && !computeOnly) {
+            InjectOverdrawCounter(sections);
+        }
+        if (selection.count(kProfileDefine)) {
+            InjectProfileClocks(sections, result.profileRegions);
+        }
+        result.timings.preprocessMs = AutoGL::detail::elapsedMs(tPre);
+
+        const bool useCache = ProgramCacheEnabled();
 
         // ==========================================================
         // CASE 1: Compute-only
         // ==========================================================
-        if (hasCompute && !hasVert && !hasFrag) {
+        if (computeOnly) {
+            // 캐시 히트면 컴파일/링크를 모두 건너뜀
+            std::uint64_t cacheKey = 0;
+            if (useCache) {
+                cacheKey = MakeProgramCacheKey("@compute\n" + sections.compute);
+
+                GLuint cached = LoadCachedProgram(cacheKey, result.bindingTypeInfo);
+                if (cached) {
+                    // SSBO 할당/바인딩은 컨텍스트 상태라 캐시할 수 없음: 저장된 레이아웃으로 재생성
+                    AutoGL::detail::reflectSSBOBindings(cached, result.bindingTypeInfo);
+                    AutoGL::detail::bindComputeSSBOs(result.bindingTypeInfo);
+                    result.timings.binaryCacheHit = true;
+                    AUTOGL_LOG_INFO("GLSLLoader", "Program loaded from binary cache");
+                    result.program = cached;
+                    return result;
+                }
+            }
+
+            GLuint program = glCreateProgram();
+            if (!program) {
+                AUTOGL_LOG_ERROR("GLSLLoader", "glCreateProgram failed");
+                return result;
+            }
 
+            auto t0 = AutoGL::detail::BuildClock::now();
             GLuint comp = GL::CompileComputeShader(sections.compute);
+            result.timings.compileMs = AutoGL::detail::elapsedMs(t0);
             if (!comp) {
                 glDeleteProgram(program);
                 return result;
             }
+
+            t0 = AutoGL::detail::BuildClock::now();
             glAttachShader(program, comp);
+            if (useCache) glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
             glLinkProgram(program);
 
             GLint ok = 0;
             glGetProgramiv(program, GL_LINK_STATUS, &ok);
+            result.timings.linkMs = AutoGL::detail::elapsedMs(t0);
             if (!ok) {
                 char log[2048];
                 glGetProgramInfoLog(program, 2048, nullptr, log);
@@ -214,7 +467,7 @@ namespace AutoGL {
             auto bindings = ScanSsboBindings(sections.compute);
 
             for (auto& b : bindings) {
-                if (b.binding < 0) continue;
+                if (b.binding < 0 || b.varName == kProfileArrayName) continue;
 
                 // (1) 타입 파싱
                 SSBOTypeInfo tinfo = ParseSingleType(b.typeName);
@@ -227,20 +480,14 @@ namespace AutoGL {
                     tinfo = ParseSingleType("float");
                 }
 
-                // SSBO 크기 = 1024 * stride
-                GLuint ssbo = AutoGL::detail::createTypedSSBO(1024, tinfo.stride);
-
-                glBindBufferBase(
-                    GL_SHADER_STORAGE_BUFFER,
-                    static_cast<GLuint>(b.binding),
-                    ssbo
-                );
-
                 // 저장: binding -> 완전 타입 정보
                 result.bindingTypeInfo[b.binding] = tinfo;
             }
 
+            // reflection으로 나머지 binding을 채운 뒤 한 번에 할당 (SSBO 크기 = 1024 * stride)
             AutoGL::detail::reflectSSBOBindings(program, result.bindingTypeInfo);
+            AutoGL::detail::bindComputeSSBOs(result.bindingTypeInfo);
+            if (useCache) StoreCachedProgram(cacheKey, program, result.bindingTypeInfo);
 
             AUTOGL_LOG_INFO("GLSLLoader", "Compute-only program built");
             result.program = program;
@@ -250,50 +497,76 @@ namespace AutoGL {
         // ==========================================================
         // CASE 2: Graphics shader (vertex + fragment)
         // ==========================================================
-        GLuint vert = 0, frag = 0;
-
-        if (hasVert) {
-            vert = GL::CompileVertexShader(sections.vertex);
-            if (!vert) {
-                glDeleteProgram(program);
-                return result;
-            }
-            glAttachShader(program, vert);
+        // stage마다 separable 프로그램으로 빌드해서 pipeline에 조합.
+        // 바뀌지 않은 stage는 캐시에서 그대로 가져오므로 reload 시 바뀐 stage만 링크
+        if (!hasFrag) {
+            AUTOGL_LOG_ERROR("GLSLLoader", "graphics shader requires @type fragment");
+            return result;
         }
 
-        if (hasFrag) {
-            frag = GL::CompileFragmentShader(sections.fragment);
-            if (!frag) {
-                if (vert) glDeleteShader(vert);
-                glDeleteProgram(program);
-                return result;
-            }
-            glAttachShader(program, frag);
-        }
+        const std::string defaultVertex = AutoGL::detail::kDefaultVertexStage;
 
-        glLinkProgram(program);
+        AutoGL::detail::StageBuild vs{ GL::ShaderStage::Vertex,   "vertex",
+                                       hasVert ? &sections.vertex : &defaultVertex };
+        AutoGL::detail::StageBuild fs{ GL::ShaderStage::Fragment, "fragment", &sections.fragment };
+        AutoGL::detail::StageBuild cs{ GL::ShaderStage::Compute,  "compute",  &sections.compute };
 
-        GLint ok = 0;
-        glGetProgramiv(program, GL_LINK_STATUS, &ok);
-        if (!ok) {
-            char log[2048];
-            glGetProgramInfoLog(program, 2048, nullptr, log);
-            AUTOGL_LOG_ERROR("GraphicLink", log);
+        AutoGL::detail::beginStage(vs, stageCache, useCache);
+        AutoGL::detail::beginStage(fs, stageCache, useCache);
+        if (hasCompute) AutoGL::detail::beginStage(cs, stageCache, useCache);
 
-            glDeleteProgram(program);
-            if (vert) glDeleteShader(vert);
-            if (frag) glDeleteShader(frag);
+        const bool vertOk = AutoGL::detail::finishStage(vs, stageCache, useCache);
+        const bool fragOk = AutoGL::detail::finishStage(fs, stageCache, useCache);
+        const bool compOk = !hasCompute || AutoGL::detail::finishStage(cs, stageCache, useCache);
+
+        result.timings.compileMs      = vs.compileMs + fs.compileMs + cs.compileMs;
+        result.timings.linkMs         = vs.linkMs + fs.linkMs + cs.linkMs;
+        result.timings.binaryCacheHit = vs.cacheHit || fs.cacheHit || cs.cacheHit;
+
+        if (!vertOk || !fragOk || !compOk) {
+            AutoGL::detail::releaseStageProgram(stageCache, vs.program);
+            AutoGL::detail::releaseStageProgram(stageCache, fs.program);
+            AutoGL::detail::releaseStageProgram(stageCache, cs.program);
             return result;
         }
 
-        if (vert) glDeleteShader(vert);
-        if (frag) glDeleteShader(frag);
+        if (vs.reused || fs.reused || cs.reused) {
+            AUTOGL_LOG_DEBUG("GLSLLoader", std::string("reused stage program:")
+                + (vs.reused ? " vertex" : "") + (fs.reused ? " fragment" : "")
+                + (cs.reused ? " compute" : ""));
+        }
 
-        AUTOGL_LOG_INFO("GLSLLoader", "Graphic program built");
+        AUTOGL_LOG_INFO("GLSLLoader", hasCompute ? "Graphic program built (with compute stage)"
+                                                 : "Graphic program built");
 
-        result.program = program;
+        result.stages.vertex   = vs.program;
+        result.stages.fragment = fs.program;
+        result.stages.compute  = cs.program;
         return result;
     }
 
+    void releaseShaderProgram(LoadedShaderProgram& ls, GL::StageProgramCache* stageCache) {
+        if (ls.program) glDeleteProgram(ls.program);
+        AutoGL::detail::releaseStageProgram(stageCache, ls.stages.vertex);
+        AutoGL::detail::releaseStageProgram(stageCache, ls.stages.fragment);
+        AutoGL::detail::releaseStageProgram(stageCache, ls.stages.compute);
+
+        ls.program = 0;
+        ls.stages  = {};
+    }
+
+    void releaseComputeBuffers(const LoadedShaderProgram& ls) {
+        for (const auto& entry : ls.bindingTypeInfo) {
+            const GLuint binding = static_cast<GLuint>(entry.first);
+            GLint buffer = 0;
+            glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING, binding, &buffer);
+            if (buffer == 0) continue;
+
+            const GLuint name = static_cast<GLuint>(buffer);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+            glDeleteBuffers(1, &name);
+        }
+    }
+
     
 } // namespace AutoGL
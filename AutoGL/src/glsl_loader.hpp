@@ -1,22 +1,95 @@
 // src/glsl_loader.hpp
 #pragma once
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <glad/glad.h>
 
 #include "glsl_types.hpp"
+#include "shader_variants.hpp"
+#include "shader_regex.hpp"
 
 
 namespace AutoGL {
 
+    class ShaderPreprocessor;
+    namespace GL { class StageProgramCache; }
+
+    // 그래픽 셰이더의 separable stage 프로그램 (program pipeline에 조합해서 사용)
+    // compute는 같은 파일의 @type compute (선택), 매 프레임 draw 전에 dispatch.
+    // SSBO는 슬롯이 계속 들고 있어서 프레임과 hot reload를 넘어 유지됨 (파티클 등 시뮬레이션 상태)
+    struct GraphicsStages {
+        GLuint vertex   = 0;
+        GLuint fragment = 0;
+        GLuint compute  = 0;
+
+        bool valid() const noexcept { return fragment != 0; }
+        bool operator==(const GraphicsStages& o) const noexcept {
+            return vertex == o.vertex && fragment == o.fragment && compute == o.compute;
+        }
+        bool operator!=(const GraphicsStages& o) const noexcept { return !(*this == o); }
+    };
+
+    // 빌드 단계별 CPU 시간 (ms). 캐시에서 가져온 단계는 0
+    struct ShaderBuildTimings {
+        double preprocessMs = 0.0;      // 파일 읽기 + include 전개 + 섹션 분리
+        double compileMs    = 0.0;      // 컴파일 제출부터 상태 확인까지
+        double linkMs       = 0.0;
+        bool   binaryCacheHit = false;  // 하나 이상의 stage를 바이너리 캐시에서 로드
+    };
+
     struct LoadedShaderProgram {
-        GLuint program = 0;
+        GLuint program = 0;         // compute 프로그램 (그래픽은 stages 사용)
+        GraphicsStages stages;
+        bool isCompute = false;     // compute-only 프로그램 여부 (그래픽과 섞인 compute는 stages.compute)
         // Type 파싱 수행
         std::unordered_map<int, SSBOTypeInfo> bindingTypeInfo;
+        // 루트 파일 + include된 파일 (hot reload 감시 대상)
+        std::vector<std::string> sourceFiles;
+
+        // 파일에 선언된 @variant 목록과 이 프로그램이 빌드된 define 집합 키
+        std::vector<VariantDecl> variants;
+        std::string variantKey;
+
+        // @instances N (0이면 instanced draw 안 함)
+        int instanceCount = 0;
+
+        // @mesh path (절대 경로, 비어 있으면 fullscreen quad)
+        std::string meshPath;
+
+        // @indirect binding maxDraws (binding SSBO의 명령으로 multi-draw indirect)
+        IndirectDrawInfo indirect;
+
+        // fragment/compute의 // @profile 구간 이름 (프로파일링 모드가 아니어도 채움)
+        std::vector<std::string> profileRegions;
+
+        // variant 주입 전 섹션 내용 해시 (내용이 같은 reload 생략용)
+        std::uint64_t sourceHash = 0;
+
+        ShaderBuildTimings timings;
     };
 
     // 전체 GLSL 파일을 파싱하여 프로그램 생성
-    LoadedShaderProgram loadShaderProgram(const std::string& path);
+    // preprocessor를 넘기면 include 조각 캐시를 재사용 (nullptr이면 매번 새로 읽음)
+    // variant가 없으면 선언된 기본값으로 빌드
+    // stageCache를 넘기면 소스가 같은 stage는 링크된 stage 프로그램을 재사용
+    // (@type vertex가 없으면 공용 fullscreen vertex stage 사용)
+    LoadedShaderProgram loadShaderProgram(const std::string& path,
+                                          ShaderPreprocessor* preprocessor = nullptr,
+                                          const VariantSelection* variant = nullptr,
+                                          GL::StageProgramCache* stageCache = nullptr);
+
+    // loadShaderProgram 결과 해제, 로드할 때와 같은 stageCache를 넘겨야 함
+    void releaseShaderProgram(LoadedShaderProgram& ls, GL::StageProgramCache* stageCache);
+
+    // compute-only 로드가 bindingTypeInfo의 binding마다 만들어 연결한 SSBO를 풀고 삭제.
+    // 바인딩은 컨텍스트 상태이므로 로드한 컨텍스트에서 호출
+    void releaseComputeBuffers(const LoadedShaderProgram& ls);
+
+    // 컴파일 없이 LoadedShaderProgram::sourceHash와 같은 값을 계산 (실패 시 0)
+    std::uint64_t hashShaderFile(const std::string& path,
+                                 ShaderPreprocessor* preprocessor = nullptr);
 
     // 내부용 헬퍼 (파일 읽기)
     std::string loadFileSource(const std::string& path);
@@ -0,0 +1,45 @@
+// src/hash_util.hpp
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace AutoGL {
+
+    // FNV-1a 64bit. 캐시 키/변경 감지용이며 암호학적 용도가 아님
+    constexpr std::uint64_t kFnvOffset = 1469598103934665603ull;
+    constexpr std::uint64_t kFnvPrime  = 1099511628211ull;
+
+    inline std::uint64_t Fnv1a64(const void* data, std::size_t size,
+                                 std::uint64_t seed = kFnvOffset) {
+        const auto* p = static_cast<const unsigned char*>(data);
+        std::uint64_t h = seed;
+        for (std::size_t i = 0; i < size; ++i) {
+            h ^= p[i];
+            h *= kFnvPrime;
+        }
+        return h;
+    }
+
+    inline std::uint64_t Fnv1a64(const std::string& s, std::uint64_t seed = kFnvOffset) {
+        return Fnv1a64(s.data(), s.size(), seed);
+    }
+
+    // 여러 문자열을 순서대로 이어 해싱할 때 경계가 섞이지 않도록 길이도 포함
+    inline std::uint64_t HashAppend(std::uint64_t h, const std::string& s) {
+        const std::uint64_t len = s.size();
+        h = Fnv1a64(&len, sizeof(len), h);
+        return Fnv1a64(s, h);
+    }
+
+    inline std::string HashToHex(std::uint64_t h) {
+        static const char* digits = "0123456789abcdef";
+        std::string out(16, '0');
+        for (int i = 15; i >= 0; --i) {
+            out[static_cast<std::size_t>(i)] = digits[h & 0xF];
+            h >>= 4;
+        }
+        return out;
+    }
+
+} // namespace AutoGL
@@ -0,0 +1,135 @@
+// src/image_writer.cpp
+#include "image_writer.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace AutoGL::detail {
+
+    static const std::array<std::uint32_t, 256>& crcTable() {
+        static const std::array<std::uint32_t, 256> table = [] {
+            std::array<std::uint32_t, 256> t{};
+            for (std::uint32_t n = 0; n < 256; ++n) {
+                std::uint32_t c = n;
+                for (int k = 0; k < 8; ++k) {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : (c >> 1);
+                }
+                t[n] = c;
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    static std::uint32_t crc32(const std::uint8_t* data, std::size_t size, std::uint32_t crc = 0) {
+        const auto& t = crcTable();
+        crc = ~crc;
+        for (std::size_t i = 0; i < size; ++i) {
+            crc = t[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    static void putBE32(std::vector<std::uint8_t>& out, std::uint32_t v) {
+        out.push_back(static_cast<std::uint8_t>(v >> 24));
+        out.push_back(static_cast<std::uint8_t>(v >> 16));
+        out.push_back(static_cast<std::uint8_t>(v >> 8));
+        out.push_back(static_cast<std::uint8_t>(v));
+    }
+
+    // length + type + data + crc(type + data)
+    static void writeChunk(std::ofstream& f, const char type[4], const std::vector<std::uint8_t>& data) {
+        std::vector<std::uint8_t> buf;
+        buf.reserve(data.size() + 12);
+        putBE32(buf, static_cast<std::uint32_t>(data.size()));
+        buf.insert(buf.end(), type, type + 4);
+        buf.insert(buf.end(), data.begin(), data.end());
+        putBE32(buf, crc32(buf.data() + 4, buf.size() - 4));
+        f.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+    }
+
+} // namespace AutoGL::detail
+
+
+namespace AutoGL {
+
+    bool WritePNG(const std::string& path, int width, int height, const std::uint8_t* rgba) {
+        if (width <= 0 || height <= 0 || !rgba) {
+            AUTOGL_LOG_ERROR("ImageWriter", "invalid image for " + path);
+            return false;
+        }
+
+        std::error_code ec;
+        const fs::path parent = fs::path(path).parent_path();
+        if (!parent.empty()) fs::create_directories(parent, ec);
+
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        if (!f) {
+            AUTOGL_LOG_ERROR("ImageWriter", "cannot open " + path);
+            return false;
+        }
+
+        static const std::uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        f.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+
+        // IHDR: 8bit RGBA, 필터/인터레이스 없음
+        std::vector<std::uint8_t> ihdr;
+        detail::putBE32(ihdr, static_cast<std::uint32_t>(width));
+        detail::putBE32(ihdr, static_cast<std::uint32_t>(height));
+        ihdr.insert(ihdr.end(), { 8, 6, 0, 0, 0 });
+        detail::writeChunk(f, "IHDR", ihdr);
+
+        // scanline = filter byte(0) + RGBA 행
+        const std::size_t rowBytes = static_cast<std::size_t>(width) * 4;
+        std::vector<std::uint8_t> raw;
+        raw.reserve((rowBytes + 1) * static_cast<std::size_t>(height));
+        for (int y = 0; y < height; ++y) {
+            raw.push_back(0);
+            const std::uint8_t* row = rgba + rowBytes * static_cast<std::size_t>(y);
+            raw.insert(raw.end(), row, row + rowBytes);
+        }
+
+        // zlib 스트림: 헤더 + stored 블록(최대 65535바이트) + adler32
+        std::vector<std::uint8_t> idat;
+        idat.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+        idat.push_back(0x78);
+        idat.push_back(0x01);
+
+        std::uint32_t a = 1, b = 0;
+        std::size_t pos = 0;
+        do {
+            const std::size_t len = std::min<std::size_t>(65535, raw.size() - pos);
+            const bool last = pos + len == raw.size();
+            idat.push_back(last ? 1 : 0);
+            idat.push_back(static_cast<std::uint8_t>(len));
+            idat.push_back(static_cast<std::uint8_t>(len >> 8));
+            idat.push_back(static_cast<std::uint8_t>(~len));
+            idat.push_back(static_cast<std::uint8_t>(~len >> 8));
+            idat.insert(idat.end(), raw.begin() + pos, raw.begin() + pos + len);
+
+            for (std::size_t i = pos; i < pos + len; ++i) {
+                a = (a + raw[i]) % 65521;
+                b = (b + a) % 65521;
+            }
+            pos += len;
+        } while (pos < raw.size());
+
+        detail::putBE32(idat, (b << 16) | a);
+        detail::writeChunk(f, "IDAT", idat);
+        detail::writeChunk(f, "IEND", {});
+
+        if (!f) {
+            AUTOGL_LOG_ERROR("ImageWriter", "write failed " + path);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace AutoGL
@@ -0,0 +1,12 @@
+// src/image_writer.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace AutoGL {
+
+    // RGBA8 이미지를 PNG로 저장 (rows는 위에서 아래 순서, stride = width * 4)
+    // 외부 의존성 없이 쓰기 위해 deflate는 압축 없는 stored 블록만 사용
+    bool WritePNG(const std::string& path, int width, int height, const std::uint8_t* rgba);
+
+} // namespace AutoGL
@@ -0,0 +1,35 @@
+// src/json_util.hpp
+#pragma once
+#include <cstdio>
+#include <string>
+
+namespace AutoGL::detail {
+
+    // 리포트/인덱스 파일용 최소 JSON 문자열 이스케이프 (따옴표 포함해서 반환)
+    inline std::string JsonString(const std::string& s) {
+        std::string out;
+        out.reserve(s.size() + 2);
+        out += '"';
+        for (char c : s) {
+            switch (c) {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n";  break;
+                case '\r': out += "\\r";  break;
+                case '\t': out += "\\t";  break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char buf[8];
+                        std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                        out += buf;
+                    }
+                    else {
+                        out += c;
+                    }
+            }
+        }
+        out += '"';
+        return out;
+    }
+
+} // namespace AutoGL::detail
@@ -1,18 +1,300 @@
 #include <AutoGL/AutoGL.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+// --batch 인자: 폴더, .glsl 파일 하나, 또는 한 줄에 경로 하나인 목록 파일
+static std::vector<std::string> collectBatchPaths(AutoGL::Engine& engine, const std::string& arg) {
+    namespace fs = std::filesystem;
+    std::vector<std::string> paths;
+
+    if (fs::is_directory(arg)) {
+        for (const auto& sf : engine.scanShaderFolder(arg))
+            paths.push_back(sf.path);
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+
+    if (fs::path(arg).extension() == ".glsl") {
+        paths.push_back(arg);
+        return paths;
+    }
+
+    // 목록 파일의 상대 경로는 목록 파일 위치 기준
+    std::ifstream list(arg);
+    const fs::path base = fs::path(arg).parent_path();
+    std::string line;
+    while (std::getline(list, line)) {
+        line.erase(0, line.find_first_not_of(" \t"));
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        if (line.empty() || line[0] == '#') continue;
+
+        fs::path p(line);
+        paths.push_back(p.is_absolute() ? p.string() : (base / p).string());
+    }
+    return paths;
+}
+
+static void printUsage() {
+    std::cout << "Usage: autogl --shader <shader.glsl> [options]\n"
+              << "       autogl --shader <a.glsl> --shader <b.glsl> ... [options]\n"
+              << "       autogl --replay <capture.aglc> [--replay-loops <n>] [--replay-image <file.png>]\n"
+              << "       autogl --ab <a.glsl> <b.glsl> [--ab-batches <n>] [--ab-frames <n>]\n"
+              << "Options:\n"
+              << "  --dashboard <folder>          show every .glsl in folder as dashboard tiles\n"
+              << "  --thumbnails <folder>         render a thumbnail atlas (.png + .json) and exit\n"
+              << "  --atlas-out <path>            atlas output path without extension\n"
+              << "  --atlas-tile <px>             thumbnail size (default 128)\n"
+              << "  --atlas-time <sec>            iTime used for every thumbnail (default 1.0)\n"
+              << "  --batch <dir|file|list>       measure every shader headlessly and exit\n"
+              << "  --frames <n>                  frames (or dispatches) per shader in batch (default 120)\n"
+              << "  --report <file.json|file.csv> batch report path (default: JSON on stdout)\n"
+              << "  --gl-debug <off|async|sync>   GL error checking mode\n"
+              << "  --program-cache <dir|off>     program binary cache location\n"
+              << "  --variant NAME=VALUE          select an @variant value (repeatable)\n"
+              << "  --continuous                  redraw every frame even for static shaders\n"
+              << "  --instances <n>               draw the graphics shader n times (overrides @instances)\n"
+              << "  --late-latch                  feed iMouse through a mapped buffer written right before the draw\n"
+              << "  --overdraw                    start with the overdraw heatmap on (F2 toggles it)\n"
+              << "  --uniform NAME=v[,v...]       set a user uniform (float..vec4, repeatable)\n"
+              << "  --specialize [frames]         bake uniforms unchanged for n frames (default 120) into constants\n"
+              << "  --profile                     time // @profile begin/end regions with ARB_shader_clock\n"
+              << "  --profile-interval <n>        frames between profile readbacks (default 120)\n"
+              << "  --capture <file.aglc>         record the GL command stream of the first drawn frames\n"
+              << "  --capture-frames <n>          frames to capture (default 1)\n"
+              << "  --replay <file.aglc>          re-issue a capture headlessly as fast as possible and exit\n"
+              << "  --replay-loops <n>            times to replay the captured frames (default 1)\n"
+              << "  --replay-image <file.png>     save the last replayed frame\n"
+              << "  --ab <a.glsl> <b.glsl>        compare GPU time of two shaders headlessly and exit\n"
+              << "  --ab-batches <n>              interleaved batches per shader (default 20, min 5 for a verdict)\n"
+              << "  --ab-frames <n>               frames per batch (default 10)\n";
+}
 
 int main(int argc, char** argv) {
-    if (argc < 3 || std::string(argv[1]) != "--shader") {
-        std::cout << "Usage: autogl --shader <shader.glsl>\n";
-        return 1;
+    std::vector<std::string> paths;
+    std::string dashboardDir;
+    std::string thumbnailDir;
+    AutoGL::ThumbnailAtlasOptions atlas;
+    std::string batchArg;
+    AutoGL::BatchOptions batch;
+    bool hasDebugMode = false;
+    AutoGL::GLDebugMode debugMode = AutoGL::GLDebugMode::Async;
+    bool hasCacheDir = false;
+    std::string cacheDir;
+    std::vector<std::pair<std::string, std::string>> variants;
+    bool continuous = false;
+    bool lateLatch = false;
+    bool overdraw = false;
+    bool profile = false;
+    std::vector<std::pair<std::string, std::vector<float>>> uniforms;
+    int specializeFrames = 0;
+    int profileInterval = 120;
+    int instances = 0;
+    std::string capturePath;
+    int captureFrames = 1;
+    std::string replayPath;
+    AutoGL::ReplayOptions replay;
+    std::string abPathA;
+    std::string abPathB;
+    AutoGL::ABTestOptions ab;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "--shader" && i + 1 < argc) {
+            paths.push_back(argv[++i]);
+        }
+        else if (arg == "--dashboard" && i + 1 < argc) {
+            dashboardDir = argv[++i];
+        }
+        else if (arg == "--thumbnails" && i + 1 < argc) {
+            thumbnailDir = argv[++i];
+        }
+        else if (arg == "--atlas-out" && i + 1 < argc) {
+            atlas.outputPath = argv[++i];
+        }
+        else if (arg == "--atlas-tile" && i + 1 < argc) {
+            atlas.tileSize = std::atoi(argv[++i]);
+        }
+        else if (arg == "--atlas-time" && i + 1 < argc) {
+            atlas.time = static_cast<float>(std::atof(argv[++i]));
+        }
+        else if (arg == "--continuous") {
+            continuous = true;
+        }
+        else if (arg == "--instances" && i + 1 < argc) {
+            instances = std::atoi(argv[++i]);
+        }
+        else if (arg == "--late-latch") {
+            lateLatch = true;
+        }
+        else if (arg == "--overdraw") {
+            overdraw = true;
+        }
+        else if (arg == "--uniform" && i + 1 < argc) {
+            std::string u = argv[++i];
+            std::size_t eq = u.find('=');
+            if (eq == std::string::npos || eq == 0) {
+                printUsage();
+                return 1;
+            }
+            std::vector<float> values;
+            std::stringstream ss(u.substr(eq + 1));
+            for (std::string v; std::getline(ss, v, ',');) {
+                values.push_back(static_cast<float>(std::atof(v.c_str())));
+            }
+            uniforms.emplace_back(u.substr(0, eq), std::move(values));
+        }
+        else if (arg == "--specialize") {
+            specializeFrames = 120;
+            if (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+                specializeFrames = std::atoi(argv[++i]);
+            }
+        }
+        else if (arg == "--profile") {
+            profile = true;
+        }
+        else if (arg == "--profile-interval" && i + 1 < argc) {
+            profileInterval = std::atoi(argv[++i]);
+        }
+        else if (arg == "--capture" && i + 1 < argc) {
+            capturePath = argv[++i];
+        }
+        else if (arg == "--capture-frames" && i + 1 < argc) {
+            captureFrames = std::atoi(argv[++i]);
+        }
+        else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        }
+        else if (arg == "--replay-loops" && i + 1 < argc) {
+            replay.loops = std::atoi(argv[++i]);
+        }
+        else if (arg == "--replay-image" && i + 1 < argc) {
+            replay.imagePath = argv[++i];
+        }
+        else if (arg == "--ab" && i + 2 < argc) {
+            abPathA = argv[++i];
+            abPathB = argv[++i];
+        }
+        else if (arg == "--ab-batches" && i + 1 < argc) {
+            ab.batches = std::atoi(argv[++i]);
+        }
+        else if (arg == "--ab-frames" && i + 1 < argc) {
+            ab.framesPerBatch = std::atoi(argv[++i]);
+        }
+        else if (arg == "--batch" && i + 1 < argc) {
+            batchArg = argv[++i];
+        }
+        else if (arg == "--frames" && i + 1 < argc) {
+            batch.frames = std::atoi(argv[++i]);
+        }
+        else if (arg == "--report" && i + 1 < argc) {
+            batch.reportPath = argv[++i];
+        }
+        else if (arg == "--gl-debug" && i + 1 < argc) {
+            std::string mode = argv[++i];
+            hasDebugMode = true;
+            if (mode == "off")        debugMode = AutoGL::GLDebugMode::Off;
+            else if (mode == "async") debugMode = AutoGL::GLDebugMode::Async;
+            else if (mode == "sync")  debugMode = AutoGL::GLDebugMode::Sync;
+            else {
+                printUsage();
+                return 1;
+            }
+        }
+        else if (arg == "--program-cache" && i + 1 < argc) {
+            cacheDir = argv[++i];
+            hasCacheDir = true;
+            if (cacheDir == "off") cacheDir.clear();
+        }
+        else if (arg == "--variant" && i + 1 < argc) {
+            std::string v = argv[++i];
+            std::size_t eq = v.find('=');
+            if (eq == std::string::npos || eq == 0) {
+                printUsage();
+                return 1;
+            }
+            variants.emplace_back(v.substr(0, eq), v.substr(eq + 1));
+        }
+        else {
+            printUsage();
+            return 1;
+        }
     }
 
-    std::string path = argv[2];
+    if (paths.empty() && dashboardDir.empty() && thumbnailDir.empty() && batchArg.empty() &&
+        replayPath.empty() && abPathA.empty()) {
+        printUsage();
+        return 1;
+    }
 
     AutoGL::Engine engine;
+    if (!dashboardDir.empty()) {
+        for (const auto& sf : engine.scanShaderFolder(dashboardDir))
+            paths.push_back(sf.path);
+    }
+    if (hasDebugMode)
+        engine.setDebugMode(debugMode);
+    if (hasCacheDir)
+        engine.setProgramCacheDir(cacheDir);
+    for (const auto& [name, value] : variants)
+        engine.setShaderVariant(name, value);
+    if (continuous)
+        engine.setOnDemandRendering(false);
+    if (lateLatch)
+        engine.setLateLatchInput(true);
+    if (overdraw)
+        engine.setOverdrawHeatmap(true);
+    if (profile)
+        engine.setShaderProfiling(true, profileInterval);
+    for (const auto& [name, values] : uniforms)
+        engine.setUniform(name, values.data(), static_cast<int>(values.size()));
+    if (specializeFrames > 0)
+        engine.setUniformSpecialization(true, specializeFrames);
+    if (instances > 0)
+        engine.setInstanceCount(instances);
+    if (!capturePath.empty())
+        engine.setCommandCapture(capturePath, captureFrames);
+
+    // 캡처 파일을 숨김 창에서 다시 실행하고 종료
+    if (!replayPath.empty()) {
+        return engine.replayCapture(replayPath, replay) ? 0 : 1;
+    }
+
+    // 두 셰이더를 숨김 창에서 번갈아 측정해서 비교하고 종료
+    if (!abPathA.empty()) {
+        return engine.runABTest(abPathA, abPathB, ab) ? 0 : 1;
+    }
+
+    // 창을 띄우지 않고 측정만 하고 종료 (실패한 셰이더가 있으면 종료 코드 1)
+    if (!batchArg.empty()) {
+        std::vector<std::string> batchPaths = collectBatchPaths(engine, batchArg);
+        if (batchPaths.empty()) {
+            std::cerr << "no shader found in " << batchArg << "\n";
+            return 1;
+        }
+        return engine.runBatch(batchPaths, batch) ? 0 : 1;
+    }
+
+    // 창을 띄우지 않고 아틀라스만 만들고 종료
+    if (!thumbnailDir.empty()) {
+        engine.scanShaderFolder(thumbnailDir, atlas);
+        return 0;
+    }
+
     if (!engine.initGL())
         return 1;
 
-    engine.mainLoop(path);
+    // 셰이더가 여러 개면 한 창에 타일로 띄움
+    if (paths.size() > 1 || !dashboardDir.empty())
+        engine.dashboardLoop(paths);
+    else
+        engine.mainLoop(paths.front());
     return 0;
 }
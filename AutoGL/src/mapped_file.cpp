@@ -0,0 +1,91 @@
+// src/mapped_file.cpp
+#include "mapped_file.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define AUTOGL_HAS_MMAP 1
+#endif
+
+namespace AutoGL {
+
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+    bool MappedFile::open(const std::string& path) {
+        close();
+
+#if defined(AUTOGL_HAS_MMAP)
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            AUTOGL_LOG_ERROR("MappedFile", "cannot open " + path);
+            return false;
+        }
+
+        struct stat st {};
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            AUTOGL_LOG_ERROR("MappedFile", "cannot stat " + path);
+            return false;
+        }
+
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ == 0) {
+            ::close(fd);
+            return true;
+        }
+
+        void* p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);    // 매핑은 fd를 닫아도 유지됨
+        if (p == MAP_FAILED) {
+            size_ = 0;
+            AUTOGL_LOG_ERROR("MappedFile", "mmap failed for " + path);
+            return false;
+        }
+
+        // 청크를 여러 스레드가 앞에서부터 동시에 읽으므로 미리 읽기 요청
+        madvise(p, size_, MADV_WILLNEED);
+
+        data_   = static_cast<const char*>(p);
+        mapped_ = true;
+        return true;
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            AUTOGL_LOG_ERROR("MappedFile", "cannot open " + path);
+            return false;
+        }
+
+        fallback_.resize(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0);
+        if (!in.read(fallback_.data(), static_cast<std::streamsize>(fallback_.size()))) {
+            fallback_.clear();
+            AUTOGL_LOG_ERROR("MappedFile", "cannot read " + path);
+            return false;
+        }
+
+        data_ = fallback_.data();
+        size_ = fallback_.size();
+        return true;
+#endif
+    }
+
+    void MappedFile::close() {
+#if defined(AUTOGL_HAS_MMAP)
+        if (mapped_) munmap(const_cast<char*>(data_), size_);
+#endif
+        mapped_ = false;
+        data_   = nullptr;
+        size_   = 0;
+        fallback_.clear();
+        fallback_.shrink_to_fit();
+    }
+
+} // namespace AutoGL
@@ -0,0 +1,33 @@
+// src/mapped_file.hpp
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace AutoGL {
+
+    // 읽기 전용 파일 매핑. POSIX에서는 mmap, 그 외에는 파일 전체를 메모리로 읽음.
+    // 여러 스레드가 data()를 동시에 읽어도 됨 (쓰기 없음)
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // 실패하면 false (로그 출력). 빈 파일은 성공, size() == 0
+        bool open(const std::string& path);
+        void close();
+
+        const char* data() const noexcept { return data_; }
+        std::size_t size() const noexcept { return size_; }
+
+    private:
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool mapped_ = false;
+        std::vector<char> fallback_;    // mmap을 못 쓰는 플랫폼용
+    };
+
+} // namespace AutoGL
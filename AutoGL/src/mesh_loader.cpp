@@ -0,0 +1,1080 @@
+// src/mesh_loader.cpp
+#include "mesh_loader.hpp"
+#include "mapped_file.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+namespace AutoGL {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        constexpr std::uint32_t kNone = 0xffffffffu;
+        // 이보다 작은 파일은 청크로 나눠도 스레드 생성 비용이 더 큼
+        constexpr std::size_t kMinChunkBytes = 1u << 20;
+
+        // ------------------------------------------------------------------
+        // 병렬 실행
+        // ------------------------------------------------------------------
+        unsigned workerCount() {
+            return std::clamp(std::thread::hardware_concurrency(), 1u, 16u);
+        }
+
+        // [0, count)를 최대 workers개의 연속 구간으로 나눠 fn(begin, end)를 동시에 실행
+        template<class Fn>
+        void parallelFor(std::size_t count, unsigned workers, Fn&& fn) {
+            const std::size_t n = std::min<std::size_t>(workers, count);
+            if (n <= 1) {
+                if (count > 0) fn(std::size_t{0}, count);
+                return;
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(n - 1);
+            for (std::size_t w = 1; w < n; ++w) {
+                threads.emplace_back([&fn, w, n, count] { fn(count * w / n, count * (w + 1) / n); });
+            }
+            fn(std::size_t{0}, count / n);
+            for (auto& t : threads) t.join();
+        }
+
+        // ------------------------------------------------------------------
+        // 텍스트 파싱
+        // ------------------------------------------------------------------
+        struct Span {
+            const char* begin;
+            const char* end;
+        };
+
+        // [begin, end)를 줄 경계에서 최대 parts개로 나눔 (청크는 항상 줄 시작에서 시작)
+        std::vector<Span> splitLines(const char* begin, const char* end, std::size_t parts) {
+            const std::size_t size = static_cast<std::size_t>(end - begin);
+            parts = std::clamp<std::size_t>(size / kMinChunkBytes, 1, parts);
+
+            std::vector<Span> out;
+            const char* cur = begin;
+            for (std::size_t i = 1; i <= parts && cur < end; ++i) {
+                const char* cut = (i == parts) ? end : std::max(cur, begin + size * i / parts);
+                if (cut < end) {
+                    const void* nl = std::memchr(cut, '\n', static_cast<std::size_t>(end - cut));
+                    cut = nl ? static_cast<const char*>(nl) + 1 : end;
+                }
+                out.push_back({ cur, cut });
+                cur = cut;
+            }
+            return out;
+        }
+
+        inline const char* skipBlanks(const char* p, const char* e) {
+            while (p < e && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+            return p;
+        }
+
+        inline const char* lineEnd(const char* p, const char* e) {
+            const void* nl = std::memchr(p, '\n', static_cast<std::size_t>(e - p));
+            return nl ? static_cast<const char*>(nl) : e;
+        }
+
+        inline const char* nextLine(const char* eol, const char* e) {
+            return eol < e ? eol + 1 : e;
+        }
+
+        // 매핑된 메모리는 0으로 끝나지 않으므로 strtof 대신 범위를 받는 from_chars
+        template<class T>
+        inline bool parseNumber(const char*& p, const char* e, T& v) {
+            p = skipBlanks(p, e);
+            if (p < e && *p == '+') ++p;
+            const auto r = std::from_chars(p, e, v);
+            if (r.ec != std::errc()) return false;
+            p = r.ptr;
+            return true;
+        }
+
+        // ------------------------------------------------------------------
+        // 정점 중복 제거
+        // ------------------------------------------------------------------
+        struct Key3 {
+            std::uint32_t a, b, c;
+            bool operator==(const Key3& o) const noexcept { return a == o.a && b == o.b && c == o.c; }
+        };
+
+        inline std::uint64_t hashKey(const Key3& k) {
+            std::uint64_t h = ((static_cast<std::uint64_t>(k.a) << 32) | k.b) * 0x9E3779B97F4A7C15ull;
+            h ^= (k.c + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+            return h ^ (h >> 31);
+        }
+
+        // linear probing 테이블. 버킷 하나를 스레드 하나가 전담하므로 락 없음
+        class KeyTable {
+        public:
+            explicit KeyTable(std::size_t expected) {
+                std::size_t capacity = 64;
+                while (capacity < expected * 2) capacity <<= 1;
+                rehash(capacity);
+            }
+
+            // 이미 있으면 그 번호, 없으면 nextId로 넣고 inserted = true
+            std::uint32_t insert(const Key3& k, std::uint32_t nextId, bool& inserted) {
+                if ((size_ + 1) * 2 > slots_.size()) rehash(slots_.size() * 2);
+
+                std::size_t i = hashKey(k) & mask_;
+                for (;;) {
+                    Slot& s = slots_[i];
+                    if (s.id == kNone) {
+                        s.key = k;
+                        s.id  = nextId;
+                        ++size_;
+                        inserted = true;
+                        return nextId;
+                    }
+                    if (s.key == k) {
+                        inserted = false;
+                        return s.id;
+                    }
+                    i = (i + 1) & mask_;
+                }
+            }
+
+        private:
+            struct Slot {
+                Key3 key{ 0, 0, 0 };
+                std::uint32_t id = kNone;
+            };
+
+            std::vector<Slot> slots_;
+            std::size_t mask_ = 0;
+            std::size_t size_ = 0;
+
+            void rehash(std::size_t capacity) {
+                std::vector<Slot> old;
+                old.swap(slots_);
+                slots_.assign(capacity, Slot{});
+                mask_ = capacity - 1;
+
+                for (const Slot& s : old) {
+                    if (s.id == kNone) continue;
+                    std::size_t i = hashKey(s.key) & mask_;
+                    while (slots_[i].id != kNone) i = (i + 1) & mask_;
+                    slots_[i] = s;
+                }
+            }
+        };
+
+        // 삼각형 꼭짓점 키에서 같은 키를 정점 하나로 합침.
+        // 해시로 버킷을 나누고 버킷마다 스레드 하나가 테이블을 맡으므로 결과는 정확히 같고 병렬.
+        // indices에 꼭짓점별 정점 번호를 쓰고 정점 번호 순서의 키 목록을 돌려줌
+        std::vector<Key3> deduplicate(const std::vector<Key3>& corners,
+                                      std::vector<std::uint32_t>& indices, unsigned workers) {
+            const std::size_t n = corners.size();
+            const std::size_t buckets = workers;
+            indices.resize(n);
+
+            std::vector<std::uint8_t> bucketOf(n);
+            parallelFor(n, workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) {
+                    bucketOf[i] = static_cast<std::uint8_t>((hashKey(corners[i]) >> 40) % buckets);
+                }
+            });
+
+            // 버킷 안에서는 첫 등장 순으로 번호를 매김 (인접 삼각형의 정점이 가까이 놓이도록)
+            std::vector<std::vector<Key3>> unique(buckets);
+            parallelFor(buckets, workers, [&](std::size_t b0, std::size_t b1) {
+                for (std::size_t b = b0; b < b1; ++b) {
+                    // 닫힌 삼각형 메시는 정점 수가 꼭짓점 수의 1/6 정도
+                    KeyTable table(n / buckets / 6);
+                    auto& keys = unique[b];
+                    for (std::size_t i = 0; i < n; ++i) {
+                        if (bucketOf[i] != b) continue;
+                        bool inserted = false;
+                        indices[i] = table.insert(corners[i], static_cast<std::uint32_t>(keys.size()), inserted);
+                        if (inserted) keys.push_back(corners[i]);
+                    }
+                }
+            });
+
+            std::vector<std::uint32_t> base(buckets + 1, 0);
+            for (std::size_t b = 0; b < buckets; ++b) {
+                base[b + 1] = base[b] + static_cast<std::uint32_t>(unique[b].size());
+            }
+
+            parallelFor(n, workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) indices[i] += base[bucketOf[i]];
+            });
+
+            std::vector<Key3> keys(base[buckets]);
+            parallelFor(buckets, workers, [&](std::size_t b0, std::size_t b1) {
+                for (std::size_t b = b0; b < b1; ++b) {
+                    std::copy(unique[b].begin(), unique[b].end(), keys.begin() + base[b]);
+                }
+            });
+            return keys;
+        }
+
+        // 법선이 0인 정점에만 인접 면 법선(외적이라 면적 가중)의 평균을 채움
+        void fillMissingNormals(MeshData& m, unsigned workers) {
+            std::atomic<bool> missing{false};
+            parallelFor(m.vertices.size(), workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e && !missing.load(std::memory_order_relaxed); ++i) {
+                    const float* n = m.vertices[i].normal;
+                    if (n[0] == 0.0f && n[1] == 0.0f && n[2] == 0.0f) missing.store(true);
+                }
+            });
+            if (!missing.load()) return;
+
+            // 정점을 여러 삼각형이 공유하므로 누적은 한 스레드에서
+            std::vector<float> acc(m.vertices.size() * 3, 0.0f);
+            for (std::size_t t = 0; t + 2 < m.indices.size(); t += 3) {
+                const std::uint32_t i0 = m.indices[t], i1 = m.indices[t + 1], i2 = m.indices[t + 2];
+                const float* p0 = m.vertices[i0].position;
+                const float* p1 = m.vertices[i1].position;
+                const float* p2 = m.vertices[i2].position;
+
+                const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+                const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+                const float fn[3] = {
+                    e1[1] * e2[2] - e1[2] * e2[1],
+                    e1[2] * e2[0] - e1[0] * e2[2],
+                    e1[0] * e2[1] - e1[1] * e2[0]
+                };
+                for (std::uint32_t v : { i0, i1, i2 }) {
+                    acc[v * 3 + 0] += fn[0];
+                    acc[v * 3 + 1] += fn[1];
+                    acc[v * 3 + 2] += fn[2];
+                }
+            }
+
+            parallelFor(m.vertices.size(), workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) {
+                    float* n = m.vertices[i].normal;
+                    if (n[0] != 0.0f || n[1] != 0.0f || n[2] != 0.0f) continue;
+
+                    const float* a = &acc[i * 3];
+                    const float len = std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]);
+                    if (len <= 0.0f) continue;
+                    n[0] = a[0] / len;
+                    n[1] = a[1] / len;
+                    n[2] = a[2] / len;
+                }
+            });
+        }
+
+        // ------------------------------------------------------------------
+        // OBJ: v / vt / vn / f (다각형은 fan으로 삼각형화)
+        // ------------------------------------------------------------------
+        struct ObjChunk {
+            std::vector<float> positions;   // xyz
+            std::vector<float> uvs;         // uv
+            std::vector<float> normals;     // xyz
+            std::vector<Key3>  corners;     // (position, uv, normal) 0 기반, 없는 성분은 kNone
+            // 음수(상대) 인덱스를 쓴 꼭짓점 번호와 성분 마스크: 청크 안 번호로 저장해 두고
+            // 앞 청크들의 개수를 알게 된 뒤 전역 번호로 고침
+            std::vector<std::pair<std::size_t, std::uint8_t>> relative;
+            std::size_t badLines = 0;
+        };
+
+        bool parseObjCorner(const char*& q, const char* eol, const ObjChunk& c,
+                            Key3& key, std::uint8_t& rel) {
+            long long idx[3] = { 0, 0, 0 };
+            if (!parseNumber(q, eol, idx[0])) return false;
+            if (q < eol && *q == '/') {
+                ++q;
+                if (q < eol && *q != '/' && !parseNumber(q, eol, idx[1])) return false;
+                if (q < eol && *q == '/') {
+                    ++q;
+                    if (!parseNumber(q, eol, idx[2])) return false;
+                }
+            }
+            if (idx[0] == 0) return false;
+
+            const long long counts[3] = {
+                static_cast<long long>(c.positions.size() / 3),
+                static_cast<long long>(c.uvs.size() / 2),
+                static_cast<long long>(c.normals.size() / 3)
+            };
+            std::uint32_t out[3];
+            rel = 0;
+            for (int i = 0; i < 3; ++i) {
+                if (idx[i] == 0) {
+                    out[i] = kNone;
+                } else if (idx[i] > 0) {
+                    if (idx[i] > static_cast<long long>(kNone)) return false;
+                    out[i] = static_cast<std::uint32_t>(idx[i] - 1);
+                } else {
+                    // 청크 앞쪽을 가리키면 음수가 되므로 32비트 2의 보수로 보관
+                    rel |= static_cast<std::uint8_t>(1u << i);
+                    out[i] = static_cast<std::uint32_t>(static_cast<std::int32_t>(counts[i] + idx[i]));
+                }
+            }
+            key = { out[0], out[1], out[2] };
+            return true;
+        }
+
+        void parseObjChunk(Span span, ObjChunk& c) {
+            std::vector<Key3> poly;
+            std::vector<std::uint8_t> polyRel;
+
+            for (const char* p = span.begin; p < span.end;) {
+                const char* eol = lineEnd(p, span.end);
+                const char* q = skipBlanks(p, eol);
+                p = nextLine(eol, span.end);
+                if (q + 1 >= eol) continue;
+
+                const char c0 = q[0];
+                const char c1 = q[1];
+                if (c0 == 'v' && (c1 == ' ' || c1 == '\t')) {
+                    q += 1;
+                    float v[3];
+                    if (parseNumber(q, eol, v[0]) && parseNumber(q, eol, v[1]) && parseNumber(q, eol, v[2])) {
+                        c.positions.insert(c.positions.end(), v, v + 3);
+                    } else {
+                        c.positions.insert(c.positions.end(), 3, 0.0f);     // 번호가 밀리지 않도록
+                        ++c.badLines;
+                    }
+                } else if (c0 == 'v' && c1 == 't') {
+                    q += 2;
+                    float v[2] = { 0.0f, 0.0f };
+                    if (!parseNumber(q, eol, v[0])) ++c.badLines;
+                    parseNumber(q, eol, v[1]);      // 1차원 텍스처 좌표 허용
+                    c.uvs.insert(c.uvs.end(), v, v + 2);
+                } else if (c0 == 'v' && c1 == 'n') {
+                    q += 2;
+                    float v[3] = { 0.0f, 0.0f, 0.0f };
+                    if (!(parseNumber(q, eol, v[0]) && parseNumber(q, eol, v[1]) && parseNumber(q, eol, v[2]))) {
+                        ++c.badLines;
+                    }
+                    c.normals.insert(c.normals.end(), v, v + 3);
+                } else if (c0 == 'f' && (c1 == ' ' || c1 == '\t')) {
+                    q += 1;
+                    poly.clear();
+                    polyRel.clear();
+                    bool ok = true;
+                    for (;;) {
+                        q = skipBlanks(q, eol);
+                        if (q >= eol) break;
+                        Key3 key{};
+                        std::uint8_t rel = 0;
+                        if (!parseObjCorner(q, eol, c, key, rel)) {
+                            ok = false;
+                            break;
+                        }
+                        poly.push_back(key);
+                        polyRel.push_back(rel);
+                    }
+                    if (!ok || poly.size() < 3) {
+                        ++c.badLines;
+                        continue;
+                    }
+
+                    for (std::size_t i = 1; i + 1 < poly.size(); ++i) {
+                        for (std::size_t k : { std::size_t{0}, i, i + 1 }) {
+                            if (polyRel[k]) c.relative.emplace_back(c.corners.size(), polyRel[k]);
+                            c.corners.push_back(poly[k]);
+                        }
+                    }
+                }
+            }
+        }
+
+        bool loadObj(const MappedFile& file, unsigned workers, MeshData& out, std::string& error) {
+            const std::vector<Span> spans = splitLines(file.data(), file.data() + file.size(), workers);
+            std::vector<ObjChunk> chunks(spans.size());
+            parallelFor(spans.size(), workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) parseObjChunk(spans[i], chunks[i]);
+            });
+
+            // 청크별 시작 번호
+            const std::size_t n = chunks.size();
+            std::vector<std::size_t> posBase(n + 1, 0), uvBase(n + 1, 0), nrmBase(n + 1, 0), cornerBase(n + 1, 0);
+            std::size_t badLines = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                posBase[i + 1]    = posBase[i]    + chunks[i].positions.size() / 3;
+                uvBase[i + 1]     = uvBase[i]     + chunks[i].uvs.size() / 2;
+                nrmBase[i + 1]    = nrmBase[i]    + chunks[i].normals.size() / 3;
+                cornerBase[i + 1] = cornerBase[i] + chunks[i].corners.size();
+                badLines += chunks[i].badLines;
+            }
+
+            const std::size_t posCount = posBase[n], uvCount = uvBase[n], nrmCount = nrmBase[n];
+            if (posCount == 0 || cornerBase[n] == 0) {
+                error = "no faces";
+                return false;
+            }
+            if (cornerBase[n] >= kNone) {
+                error = "too many faces";
+                return false;
+            }
+
+            // 청크 결과를 이어 붙이면서 상대 인덱스를 고치고 범위를 검사
+            std::vector<float> positions(posCount * 3), uvs(uvCount * 2), normals(nrmCount * 3);
+            std::vector<Key3> corners(cornerBase[n]);
+            std::atomic<std::size_t> badIndices{0};
+            parallelFor(n, workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) {
+                    ObjChunk& c = chunks[i];
+                    std::copy(c.positions.begin(), c.positions.end(), positions.begin() + posBase[i] * 3);
+                    std::copy(c.uvs.begin(),       c.uvs.end(),       uvs.begin()       + uvBase[i] * 2);
+                    std::copy(c.normals.begin(),   c.normals.end(),   normals.begin()   + nrmBase[i] * 3);
+
+                    for (const auto& [corner, mask] : c.relative) {
+                        Key3& k = c.corners[corner];
+                        std::uint32_t* comp[3] = { &k.a, &k.b, &k.c };
+                        const std::size_t bases[3] = { posBase[i], uvBase[i], nrmBase[i] };
+                        for (int j = 0; j < 3; ++j) {
+                            if (!(mask & (1u << j))) continue;
+                            const long long g = static_cast<long long>(bases[j]) +
+                                                static_cast<std::int32_t>(*comp[j]);
+                            *comp[j] = g < 0 ? kNone - 1 : static_cast<std::uint32_t>(g);
+                        }
+                    }
+
+                    std::size_t bad = 0;
+                    for (Key3& k : c.corners) {
+                        if (k.a >= posCount) { k.a = 0; ++bad; }
+                        if (k.b != kNone && k.b >= uvCount)  { k.b = kNone; ++bad; }
+                        if (k.c != kNone && k.c >= nrmCount) { k.c = kNone; ++bad; }
+                    }
+                    badIndices += bad;
+
+                    std::copy(c.corners.begin(), c.corners.end(), corners.begin() + cornerBase[i]);
+                    c = ObjChunk{};     // 최대 메모리를 줄이기 위해 바로 해제
+                }
+            });
+
+            if (badLines > 0) {
+                AUTOGL_LOG_WARN("MeshLoader", std::to_string(badLines) + " malformed OBJ lines skipped");
+            }
+            if (badIndices > 0) {
+                AUTOGL_LOG_WARN("MeshLoader", std::to_string(badIndices.load()) + " out of range OBJ indices");
+            }
+
+            const std::vector<Key3> keys = deduplicate(corners, out.indices, workers);
+            corners = {};
+
+            out.vertices.resize(keys.size());
+            parallelFor(keys.size(), workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) {
+                    const Key3& k = keys[i];
+                    MeshVertex& v = out.vertices[i];
+                    std::memcpy(v.position, &positions[std::size_t{k.a} * 3], sizeof(v.position));
+                    if (k.b != kNone) std::memcpy(v.uv, &uvs[std::size_t{k.b} * 2], sizeof(v.uv));
+                    else              v.uv[0] = v.uv[1] = 0.0f;
+                    if (k.c != kNone) std::memcpy(v.normal, &normals[std::size_t{k.c} * 3], sizeof(v.normal));
+                    else              v.normal[0] = v.normal[1] = v.normal[2] = 0.0f;
+                }
+            });
+            return true;
+        }
+
+        // ------------------------------------------------------------------
+        // PLY: ascii / binary_little_endian / binary_big_endian, vertex + face 요소
+        // ------------------------------------------------------------------
+        enum class PlyType { Invalid, Int8, UInt8, Int16, UInt16, Int32, UInt32, Float32, Float64 };
+
+        PlyType plyType(const std::string& s) {
+            if (s == "char"   || s == "int8")    return PlyType::Int8;
+            if (s == "uchar"  || s == "uint8")   return PlyType::UInt8;
+            if (s == "short"  || s == "int16")   return PlyType::Int16;
+            if (s == "ushort" || s == "uint16")  return PlyType::UInt16;
+            if (s == "int"    || s == "int32")   return PlyType::Int32;
+            if (s == "uint"   || s == "uint32")  return PlyType::UInt32;
+            if (s == "float"  || s == "float32") return PlyType::Float32;
+            if (s == "double" || s == "float64") return PlyType::Float64;
+            return PlyType::Invalid;
+        }
+
+        std::size_t plySize(PlyType t) {
+            switch (t) {
+                case PlyType::Int8:  case PlyType::UInt8:   return 1;
+                case PlyType::Int16: case PlyType::UInt16:  return 2;
+                case PlyType::Int32: case PlyType::UInt32:
+                case PlyType::Float32:                      return 4;
+                case PlyType::Float64:                      return 8;
+                default:                                    return 0;
+            }
+        }
+
+        template<class T>
+        T loadScalar(const char* p, bool swap) {
+            char b[sizeof(T)];
+            std::memcpy(b, p, sizeof(T));
+            if (swap) std::reverse(b, b + sizeof(T));
+            T v;
+            std::memcpy(&v, b, sizeof(T));
+            return v;
+        }
+
+        double readBinary(const char* p, PlyType t, bool swap) {
+            switch (t) {
+                case PlyType::Int8:    return static_cast<std::int8_t>(*p);
+                case PlyType::UInt8:   return static_cast<std::uint8_t>(*p);
+                case PlyType::Int16:   return loadScalar<std::int16_t>(p, swap);
+                case PlyType::UInt16:  return loadScalar<std::uint16_t>(p, swap);
+                case PlyType::Int32:   return loadScalar<std::int32_t>(p, swap);
+                case PlyType::UInt32:  return loadScalar<std::uint32_t>(p, swap);
+                case PlyType::Float32: return loadScalar<float>(p, swap);
+                case PlyType::Float64: return loadScalar<double>(p, swap);
+                default:               return 0.0;
+            }
+        }
+
+        struct PlyProperty {
+            std::string name;
+            PlyType type = PlyType::Invalid;        // list면 원소 타입
+            PlyType countType = PlyType::Invalid;   // list가 아니면 Invalid
+            int slot = -1;                          // vertex: MeshVertex 안의 float 위치
+            bool isList() const noexcept { return countType != PlyType::Invalid; }
+        };
+
+        struct PlyElement {
+            std::string name;
+            std::size_t count = 0;
+            std::vector<PlyProperty> props;
+
+            // list가 없으면 레코드 크기, 있으면 0
+            std::size_t stride() const {
+                std::size_t s = 0;
+                for (const auto& p : props) {
+                    if (p.isList()) return 0;
+                    s += plySize(p.type);
+                }
+                return s;
+            }
+        };
+
+        enum class PlyFormat { Ascii, BinaryLE, BinaryBE };
+
+        struct PlyHeader {
+            PlyFormat format = PlyFormat::Ascii;
+            std::vector<PlyElement> elements;
+            std::size_t bodyOffset = 0;
+        };
+
+        // MeshVertex를 float 8개로 보고 속성 이름을 위치로 대응 (position 0-2, uv 3-4, normal 5-7)
+        int vertexSlot(const std::string& n) {
+            if (n == "x")  return 0;
+            if (n == "y")  return 1;
+            if (n == "z")  return 2;
+            if (n == "u" || n == "s" || n == "texture_u" || n == "texture_s") return 3;
+            if (n == "v" || n == "t" || n == "texture_v" || n == "texture_t") return 4;
+            if (n == "nx") return 5;
+            if (n == "ny") return 6;
+            if (n == "nz") return 7;
+            return -1;
+        }
+
+        inline void setSlot(MeshVertex& v, int slot, float value) {
+            if (slot < 3)      v.position[slot]  = value;
+            else if (slot < 5) v.uv[slot - 3]    = value;
+            else               v.normal[slot - 5] = value;
+        }
+
+        bool parsePlyHeader(const MappedFile& file, PlyHeader& h, std::string& error) {
+            const char* data = file.data();
+            const char* end  = data + file.size();
+            if (file.size() < 4 || std::memcmp(data, "ply", 3) != 0) {
+                error = "not a PLY file";
+                return false;
+            }
+
+            bool hasFormat = false;
+            for (const char* p = data; p < end;) {
+                const char* eol = lineEnd(p, end);
+                std::istringstream line(std::string(p, eol));
+                p = nextLine(eol, end);
+
+                std::string word;
+                line >> word;
+                if (word == "format") {
+                    std::string fmt;
+                    line >> fmt;
+                    if (fmt == "ascii")                     h.format = PlyFormat::Ascii;
+                    else if (fmt == "binary_little_endian") h.format = PlyFormat::BinaryLE;
+                    else if (fmt == "binary_big_endian")    h.format = PlyFormat::BinaryBE;
+                    else {
+                        error = "unknown PLY format " + fmt;
+                        return false;
+                    }
+                    hasFormat = true;
+                } else if (word == "element") {
+                    PlyElement e;
+                    line >> e.name >> e.count;
+                    h.elements.push_back(std::move(e));
+                } else if (word == "property") {
+                    if (h.elements.empty()) {
+                        error = "PLY property before element";
+                        return false;
+                    }
+                    PlyProperty prop;
+                    std::string type;
+                    line >> type;
+                    if (type == "list") {
+                        std::string countType, itemType;
+                        line >> countType >> itemType;
+                        prop.countType = plyType(countType);
+                        prop.type      = plyType(itemType);
+                        if (prop.countType == PlyType::Invalid) {
+                            error = "unknown PLY type " + countType;
+                            return false;
+                        }
+                    } else {
+                        prop.type = plyType(type);
+                    }
+                    line >> prop.name;
+                    if (prop.type == PlyType::Invalid) {
+                        error = "unknown PLY type in property " + prop.name;
+                        return false;
+                    }
+                    h.elements.back().props.push_back(std::move(prop));
+                } else if (word == "end_header") {
+                    h.bodyOffset = static_cast<std::size_t>(p - data);
+                    if (!hasFormat) {
+                        error = "PLY header without format";
+                        return false;
+                    }
+                    return true;
+                }
+            }
+            error = "PLY header without end_header";
+            return false;
+        }
+
+        // face 요소에서 정점 인덱스 list 위치
+        int faceListIndex(const PlyElement& e) {
+            for (std::size_t i = 0; i < e.props.size(); ++i) {
+                const auto& p = e.props[i];
+                if (p.isList() && (p.name == "vertex_indices" || p.name == "vertex_index")) {
+                    return static_cast<int>(i);
+                }
+            }
+            return -1;
+        }
+
+        // fan 삼각형화, 범위를 벗어난 인덱스가 있는 삼각형은 버림
+        inline void emitPolygon(const std::uint32_t* poly, std::size_t n, std::size_t vertexCount,
+                                std::vector<std::uint32_t>& tris, std::size_t& bad) {
+            for (std::size_t i = 1; i + 1 < n; ++i) {
+                const std::uint32_t a = poly[0], b = poly[i], c = poly[i + 1];
+                if (a >= vertexCount || b >= vertexCount || c >= vertexCount) {
+                    ++bad;
+                    continue;
+                }
+                tris.push_back(a);
+                tris.push_back(b);
+                tris.push_back(c);
+            }
+        }
+
+        bool loadPlyBinary(const MappedFile& file, const PlyHeader& h, unsigned workers,
+                           MeshData& out, std::string& error) {
+            const bool swap = h.format == PlyFormat::BinaryBE;
+            const char* data = file.data();
+            const std::size_t size = file.size();
+            std::size_t offset = h.bodyOffset;
+
+            std::size_t vertexCount = 0;
+            for (const auto& e : h.elements) {
+                if (e.name == "vertex") vertexCount = e.count;
+            }
+
+            bool haveVertices = false;
+            bool haveFaces = false;
+            std::size_t bad = 0;
+
+            for (const auto& e : h.elements) {
+                if (haveVertices && haveFaces) break;
+
+                if (e.name == "vertex") {
+                    const std::size_t stride = e.stride();
+                    if (stride == 0) {
+                        error = "list properties in PLY vertex element are not supported";
+                        return false;
+                    }
+                    if (offset + e.count * stride > size) {
+                        error = "truncated PLY vertex data";
+                        return false;
+                    }
+
+                    std::vector<std::size_t> offsets;
+                    std::size_t o = 0;
+                    for (const auto& p : e.props) {
+                        offsets.push_back(o);
+                        o += plySize(p.type);
+                    }
+
+                    // 레코드 크기가 고정이므로 정점 범위를 그대로 나눠서 병렬 변환
+                    out.vertices.resize(e.count);
+                    const char* base = data + offset;
+                    parallelFor(e.count, workers, [&](std::size_t b, std::size_t end) {
+                        for (std::size_t i = b; i < end; ++i) {
+                            MeshVertex v{};
+                            const char* rec = base + i * stride;
+                            for (std::size_t k = 0; k < e.props.size(); ++k) {
+                                const PlyProperty& p = e.props[k];
+                                if (p.slot < 0) continue;
+                                setSlot(v, p.slot, static_cast<float>(readBinary(rec + offsets[k], p.type, swap)));
+                            }
+                            out.vertices[i] = v;
+                        }
+                    });
+                    offset += e.count * stride;
+                    haveVertices = true;
+                    continue;
+                }
+
+                if (e.name == "face") {
+                    const int list = faceListIndex(e);
+                    if (list < 0) {
+                        error = "PLY face element without vertex_indices";
+                        return false;
+                    }
+                    const PlyProperty& lp = e.props[static_cast<std::size_t>(list)];
+                    const std::size_t cs = plySize(lp.countType);
+                    const std::size_t is = plySize(lp.type);
+
+                    // 스캔 데이터는 거의 항상 삼각형만 있으므로 레코드 크기를 고정으로 보고 병렬 파싱,
+                    // 삼각형이 아닌 면이 하나라도 있으면 순차 파싱으로 다시
+                    const std::size_t triRecord = cs + 3 * is;
+                    if (e.props.size() == 1 && offset + e.count * triRecord <= size) {
+                        std::atomic<bool> allTriangles{true};
+                        std::atomic<std::size_t> badTris{0};
+                        out.indices.resize(e.count * 3);
+                        const char* base = data + offset;
+                        parallelFor(e.count, workers, [&](std::size_t b, std::size_t end) {
+                            std::size_t localBad = 0;
+                            for (std::size_t i = b; i < end; ++i) {
+                                const char* rec = base + i * triRecord;
+                                if (readBinary(rec, lp.countType, swap) != 3.0) {
+                                    allTriangles.store(false, std::memory_order_relaxed);
+                                    return;
+                                }
+                                for (std::size_t k = 0; k < 3; ++k) {
+                                    const double idx = readBinary(rec + cs + k * is, lp.type, swap);
+                                    if (idx < 0.0 || idx >= static_cast<double>(vertexCount)) {
+                                        ++localBad;
+                                        out.indices[i * 3 + k] = 0;
+                                    } else {
+                                        out.indices[i * 3 + k] = static_cast<std::uint32_t>(idx);
+                                    }
+                                }
+                            }
+                            badTris += localBad;
+                        });
+                        if (allTriangles.load()) {
+                            bad += badTris.load();
+                            offset += e.count * triRecord;
+                            haveFaces = true;
+                            continue;
+                        }
+                        out.indices.clear();
+                    }
+
+                    std::vector<std::uint32_t> poly;
+                    for (std::size_t f = 0; f < e.count; ++f) {
+                        for (std::size_t k = 0; k < e.props.size(); ++k) {
+                            const PlyProperty& p = e.props[k];
+                            if (!p.isList()) {
+                                offset += plySize(p.type);
+                                continue;
+                            }
+                            if (offset + plySize(p.countType) > size) {
+                                error = "truncated PLY face data";
+                                return false;
+                            }
+                            const auto n = static_cast<std::size_t>(readBinary(data + offset, p.countType, swap));
+                            offset += plySize(p.countType);
+                            if (offset + n * plySize(p.type) > size) {
+                                error = "truncated PLY face data";
+                                return false;
+                            }
+                            if (static_cast<int>(k) == list) {
+                                poly.resize(n);
+                                for (std::size_t j = 0; j < n; ++j) {
+                                    const double idx = readBinary(data + offset + j * is, p.type, swap);
+                                    poly[j] = idx < 0.0 ? kNone : static_cast<std::uint32_t>(idx);
+                                }
+                                emitPolygon(poly.data(), n, vertexCount, out.indices, bad);
+                            }
+                            offset += n * plySize(p.type);
+                        }
+                    }
+                    haveFaces = true;
+                    continue;
+                }
+
+                // 그 밖의 요소는 건너뜀 (list가 있으면 크기를 알 수 없음)
+                const std::size_t stride = e.stride();
+                if (stride == 0 && e.count > 0) {
+                    error = "unsupported PLY element " + e.name;
+                    return false;
+                }
+                offset += e.count * stride;
+            }
+
+            if (bad > 0) {
+                AUTOGL_LOG_WARN("MeshLoader", std::to_string(bad) + " PLY faces with out of range indices");
+            }
+            return true;
+        }
+
+        bool loadPlyAscii(const MappedFile& file, const PlyHeader& h, unsigned workers,
+                          MeshData& out, std::string& error) {
+            // 요소마다 차지하는 줄 범위
+            struct Range { const PlyElement* element; std::size_t first, last; };
+            std::vector<Range> ranges;
+            std::size_t line = 0;
+            std::size_t vertexCount = 0;
+            for (const auto& e : h.elements) {
+                ranges.push_back({ &e, line, line + e.count });
+                line += e.count;
+                if (e.name == "vertex") {
+                    vertexCount = e.count;
+                    if (e.stride() == 0) {
+                        error = "list properties in PLY vertex element are not supported";
+                        return false;
+                    }
+                }
+            }
+
+            const char* body = file.data() + h.bodyOffset;
+            const char* end  = file.data() + file.size();
+            const std::vector<Span> spans = splitLines(body, end, workers);
+
+            // 1) 청크별 줄 수를 세서 각 청크의 첫 줄 번호를 구함
+            std::vector<std::size_t> firstLine(spans.size() + 1, 0);
+            parallelFor(spans.size(), workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) {
+                    firstLine[i + 1] = static_cast<std::size_t>(
+                        std::count(spans[i].begin, spans[i].end, '\n'));
+                }
+            });
+            for (std::size_t i = 0; i < spans.size(); ++i) firstLine[i + 1] += firstLine[i];
+
+            // 2) 줄 번호로 요소를 정해서 파싱, 정점은 바로 제자리에 씀
+            out.vertices.assign(vertexCount, MeshVertex{});
+            std::vector<std::vector<std::uint32_t>> tris(spans.size());
+            std::atomic<std::size_t> bad{0};
+            std::atomic<std::size_t> malformed{0};
+
+            parallelFor(spans.size(), workers, [&](std::size_t b, std::size_t e) {
+                std::vector<std::uint32_t> poly;
+                for (std::size_t ci = b; ci < e; ++ci) {
+                    std::size_t localBad = 0;
+                    std::size_t localMalformed = 0;
+                    std::size_t ln = firstLine[ci];
+                    std::size_t r = 0;
+
+                    for (const char* p = spans[ci].begin; p < spans[ci].end; ++ln) {
+                        const char* eol = lineEnd(p, spans[ci].end);
+                        const char* q = p;
+                        p = nextLine(eol, spans[ci].end);
+
+                        while (r < ranges.size() && ln >= ranges[r].last) ++r;
+                        if (r == ranges.size()) break;
+                        if (ln < ranges[r].first) continue;
+                        const PlyElement& el = *ranges[r].element;
+
+                        if (el.name == "vertex") {
+                            MeshVertex v{};
+                            for (const auto& prop : el.props) {
+                                double value = 0.0;
+                                if (!parseNumber(q, eol, value)) {
+                                    ++localMalformed;
+                                    break;
+                                }
+                                if (prop.slot >= 0) setSlot(v, prop.slot, static_cast<float>(value));
+                            }
+                            out.vertices[ln - ranges[r].first] = v;
+                        } else if (el.name == "face") {
+                            for (const auto& prop : el.props) {
+                                double value = 0.0;
+                                if (!prop.isList()) {
+                                    parseNumber(q, eol, value);
+                                    continue;
+                                }
+                                long long n = 0;
+                                if (!parseNumber(q, eol, n) || n < 0) {
+                                    ++localMalformed;
+                                    break;
+                                }
+                                poly.clear();
+                                for (long long j = 0; j < n; ++j) {
+                                    long long idx = 0;
+                                    if (!parseNumber(q, eol, idx)) {
+                                        ++localMalformed;
+                                        break;
+                                    }
+                                    poly.push_back(idx < 0 || idx >= static_cast<long long>(kNone)
+                                                   ? kNone : static_cast<std::uint32_t>(idx));
+                                }
+                                if (prop.name == "vertex_indices" || prop.name == "vertex_index") {
+                                    emitPolygon(poly.data(), poly.size(), vertexCount, tris[ci], localBad);
+                                }
+                            }
+                        }
+                    }
+                    bad += localBad;
+                    malformed += localMalformed;
+                }
+            });
+
+            if (firstLine.back() < line) {
+                error = "truncated PLY data";
+                return false;
+            }
+            if (malformed > 0) {
+                AUTOGL_LOG_WARN("MeshLoader", std::to_string(malformed.load()) + " malformed PLY lines");
+            }
+            if (bad > 0) {
+                AUTOGL_LOG_WARN("MeshLoader", std::to_string(bad.load()) + " PLY faces with out of range indices");
+            }
+
+            std::vector<std::size_t> triBase(tris.size() + 1, 0);
+            for (std::size_t i = 0; i < tris.size(); ++i) triBase[i + 1] = triBase[i] + tris[i].size();
+            out.indices.resize(triBase.back());
+            parallelFor(tris.size(), workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) {
+                    std::copy(tris[i].begin(), tris[i].end(), out.indices.begin() + triBase[i]);
+                }
+            });
+            return true;
+        }
+
+        // PLY는 이미 인덱스가 있는 형식이라 정점 중복 제거를 하지 않음
+        bool loadPly(const MappedFile& file, unsigned workers, MeshData& out, std::string& error) {
+            PlyHeader h;
+            if (!parsePlyHeader(file, h, error)) return false;
+
+            bool hasVertex = false;
+            for (auto& e : h.elements) {
+                if (e.name != "vertex") continue;
+                hasVertex = true;
+                for (auto& p : e.props) p.slot = vertexSlot(p.name);
+            }
+            if (!hasVertex) {
+                error = "PLY file without vertex element";
+                return false;
+            }
+
+            return h.format == PlyFormat::Ascii
+                ? loadPlyAscii(file, h, workers, out, error)
+                : loadPlyBinary(file, h, workers, out, error);
+        }
+
+        // ------------------------------------------------------------------
+        // binary STL: 삼각형마다 법선 + 꼭짓점 3개, 위치가 같은 꼭짓점을 합침
+        // ------------------------------------------------------------------
+        bool loadStl(const MappedFile& file, unsigned workers, MeshData& out, std::string& error) {
+            const char* data = file.data();
+            const std::size_t size = file.size();
+            if (size < 84) {
+                error = "truncated STL file";
+                return false;
+            }
+
+            const std::size_t triCount = loadScalar<std::uint32_t>(data + 80, false);
+            if (84 + triCount * 50 > size) {
+                error = std::memcmp(data, "solid", 5) == 0
+                    ? "ASCII STL is not supported, export as binary STL"
+                    : "truncated STL file";
+                return false;
+            }
+            if (triCount * 3 >= kNone) {
+                error = "too many triangles";
+                return false;
+            }
+
+            // 위치 비트 패턴을 키로 사용 (-0.0은 0.0과 같게)
+            std::vector<Key3> corners(triCount * 3);
+            parallelFor(triCount, workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t t = b; t < e; ++t) {
+                    const char* rec = data + 84 + t * 50 + 12;     // 면 법선은 건너뜀
+                    for (std::size_t k = 0; k < 3; ++k) {
+                        std::uint32_t bits[3];
+                        std::memcpy(bits, rec + k * 12, sizeof(bits));
+                        for (auto& v : bits) {
+                            if (v == 0x80000000u) v = 0;
+                        }
+                        corners[t * 3 + k] = { bits[0], bits[1], bits[2] };
+                    }
+                }
+            });
+
+            const std::vector<Key3> keys = deduplicate(corners, out.indices, workers);
+            corners = {};
+
+            out.vertices.resize(keys.size());
+            parallelFor(keys.size(), workers, [&](std::size_t b, std::size_t e) {
+                for (std::size_t i = b; i < e; ++i) {
+                    MeshVertex v{};
+                    std::memcpy(v.position, &keys[i], sizeof(v.position));
+                    out.vertices[i] = v;
+                }
+            });
+            return true;
+        }
+
+        std::string lowerExtension(const std::string& path) {
+            std::string ext = std::filesystem::path(path).extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return ext;
+        }
+
+    } // namespace
+
+    bool LoadMesh(const std::string& path, MeshData& out, unsigned workers) {
+        out = MeshData{};
+        const auto t0 = Clock::now();
+
+        MappedFile file;
+        if (!file.open(path)) return false;
+
+        if (workers == 0) workers = workerCount();
+        const std::string ext = lowerExtension(path);
+        std::string error;
+        bool ok = false;
+
+        if (ext == ".obj")      ok = loadObj(file, workers, out, error);
+        else if (ext == ".ply") ok = loadPly(file, workers, out, error);
+        else if (ext == ".stl") ok = loadStl(file, workers, out, error);
+        else error = "unsupported mesh format (expected .obj, .ply or .stl)";
+
+        if (ok && out.indices.size() < 3) {
+            ok = false;
+            error = "no triangles";
+        }
+        if (!ok) {
+            AUTOGL_LOG_ERROR("MeshLoader", path + ": " + error);
+            out = MeshData{};
+            return false;
+        }
+
+        fillMissingNormals(out, workers);
+
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        const double mb = static_cast<double>(file.size()) / (1024.0 * 1024.0);
+        std::ostringstream msg;
+        msg << std::fixed << std::setprecision(1)
+            << std::filesystem::path(path).filename().string() << ": "
+            << out.vertices.size() << " vertices, " << out.indices.size() / 3 << " triangles, "
+            << ms << " ms (" << (ms > 0.0 ? mb * 1000.0 / ms : 0.0) << " MB/s, "
+            << workers << " threads)";
+        AUTOGL_LOG_INFO("MeshLoader", msg.str());
+        return true;
+    }
+
+} // namespace AutoGL
@@ -0,0 +1,29 @@
+// src/mesh_loader.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace AutoGL {
+
+    // @mesh 정점 하나. attribute location 0 = position, 1 = uv, 2 = normal
+    // (location 0/1은 fullscreen quad의 aPos/aUV와 같은 자리)
+    struct MeshVertex {
+        float position[3];
+        float uv[2];
+        float normal[3];
+    };
+
+    struct MeshData {
+        std::vector<MeshVertex>    vertices;
+        std::vector<std::uint32_t> indices;     // 삼각형 목록 (3개씩)
+    };
+
+    // OBJ, PLY (ascii / binary), binary STL을 확장자로 판별해서 로드.
+    // 파일을 메모리 매핑한 뒤 줄(또는 레코드) 경계로 나눈 청크를 여러 스레드에서 파싱하고 합침.
+    // 같은 정점(OBJ는 v/vt/vn 조합, STL은 위치)은 하나로 합쳐 인덱스 버퍼를 만들고,
+    // 파일에 법선이 없으면 면 법선을 면적 가중 평균해서 채움.
+    // workers는 파싱 스레드 수 (0이면 CPU 수, 최대 16). 실패하면 false (로그 출력)
+    bool LoadMesh(const std::string& path, MeshData& out, unsigned workers = 0);
+
+} // namespace AutoGL
@@ -0,0 +1,282 @@
+// src/program_binary_cache.cpp
+#include "program_binary_cache.hpp"
+#include "hash_util.hpp"
+#include "byte_io.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace AutoGL::detail {
+
+    constexpr char          kCacheMagic[4] = { 'A', 'G', 'P', 'B' };
+    constexpr std::uint32_t kCacheVersion  = 1;
+
+    struct ProgramCacheState {
+        std::mutex mutex;
+        bool resolved = false;
+        std::string dir;
+    };
+
+    static ProgramCacheState& cacheState() {
+        static ProgramCacheState s;
+        return s;
+    }
+
+    static std::string defaultCacheDirectory() {
+        if (const char* env = std::getenv("AUTOGL_CACHE_DIR")) {
+            return env;
+        }
+#if defined(_WIN32)
+        if (const char* local = std::getenv("LOCALAPPDATA")) {
+            return (fs::path(local) / "AutoGL").string();
+        }
+#else
+        if (const char* xdg = std::getenv("XDG_CACHE_HOME")) {
+            if (*xdg) return (fs::path(xdg) / "autogl").string();
+        }
+        if (const char* home = std::getenv("HOME")) {
+            return (fs::path(home) / ".cache" / "autogl").string();
+        }
+#endif
+        return {};
+    }
+
+    static std::string cacheDirectory() {
+        auto& s = cacheState();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (!s.resolved) {
+            s.dir = defaultCacheDirectory();
+            s.resolved = true;
+        }
+        return s.dir;
+    }
+
+    static fs::path cacheFilePath(const std::string& dir, std::uint64_t key) {
+        return fs::path(dir) / (HashToHex(key) + ".bin");
+    }
+
+    static void writeTypeInfo(ByteWriter& w, const SSBOTypeInfo& t) {
+        w.str(t.rawType);
+        w.u8(static_cast<std::uint8_t>(t.base));
+        w.i32(t.components);
+        w.i32(t.stride);
+        w.u8(t.isArray ? 1 : 0);
+
+        w.u32(static_cast<std::uint32_t>(t.members.size()));
+        for (const auto& m : t.members) {
+            w.str(m.name);
+            w.u8(static_cast<std::uint8_t>(m.base));
+            w.i32(m.components);
+            w.i32(m.arraySize);
+            w.i32(m.offset);
+            w.i32(m.stride);
+        }
+    }
+
+    static SSBOTypeInfo readTypeInfo(ByteReader& r) {
+        SSBOTypeInfo t;
+        t.rawType    = r.str();
+        t.base       = static_cast<SSBOBaseType>(r.u8());
+        t.components = r.i32();
+        t.stride     = r.i32();
+        t.isArray    = r.u8() != 0;
+
+        const std::uint32_t memberCount = r.u32();
+        for (std::uint32_t i = 0; i < memberCount && r.ok(); ++i) {
+            SSBOMemberInfo m;
+            m.name       = r.str();
+            m.base       = static_cast<SSBOBaseType>(r.u8());
+            m.components = r.i32();
+            m.arraySize  = r.i32();
+            m.offset     = r.i32();
+            m.stride     = r.i32();
+            t.members.push_back(std::move(m));
+        }
+        return t;
+    }
+
+    static bool readWholeFile(const fs::path& path, std::vector<char>& out) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in.is_open()) return false;
+
+        const std::streamsize size = in.tellg();
+        if (size <= 0) return false;
+
+        out.resize(static_cast<std::size_t>(size));
+        in.seekg(0);
+        return static_cast<bool>(in.read(out.data(), size));
+    }
+
+} // namespace AutoGL::detail
+
+namespace AutoGL {
+
+    void SetProgramCacheDirectory(const std::string& dir) {
+        auto& s = detail::cacheState();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.dir = dir;
+        s.resolved = true;
+    }
+
+    std::string ProgramCacheDirectory() {
+        return detail::cacheDirectory();
+    }
+
+    bool ProgramCacheEnabled() {
+        return !detail::cacheDirectory().empty();
+    }
+
+    std::uint64_t MakeProgramCacheKey(const std::string& preprocessedSource) {
+        auto glStr = [](GLenum name) {
+            const GLubyte* s = glGetString(name);
+            return s ? std::string(reinterpret_cast<const char*>(s)) : std::string();
+        };
+
+        std::uint64_t h = kFnvOffset;
+        h = HashAppend(h, glStr(GL_RENDERER));
+        h = HashAppend(h, glStr(GL_VERSION));
+        h = HashAppend(h, preprocessedSource);
+        return h;
+    }
+
+    GLuint LoadCachedProgram(std::uint64_t key,
+                             std::unordered_map<int, SSBOTypeInfo>& ssboLayout,
+                             bool separable) {
+        const std::string dir = detail::cacheDirectory();
+        if (dir.empty()) return 0;
+
+        const fs::path file = detail::cacheFilePath(dir, key);
+        std::vector<char> data;
+        if (!detail::readWholeFile(file, data)) return 0;
+
+        detail::ByteReader r(data.data(), data.size());
+
+        const char* magic = r.take(sizeof(detail::kCacheMagic));
+        const bool headerOk = magic
+            && std::memcmp(magic, detail::kCacheMagic, sizeof(detail::kCacheMagic)) == 0
+            && r.u32() == detail::kCacheVersion
+            && r.u64() == key;
+
+        std::unordered_map<int, SSBOTypeInfo> layout;
+        GLenum format = 0;
+        const char* binary = nullptr;
+        std::uint32_t binaryLength = 0;
+
+        if (headerOk) {
+            format = static_cast<GLenum>(r.u32());
+
+            const std::uint32_t ssboCount = r.u32();
+            for (std::uint32_t i = 0; i < ssboCount && r.ok(); ++i) {
+                const int binding = r.i32();
+                layout[binding] = detail::readTypeInfo(r);
+            }
+
+            binaryLength = r.u32();
+            binary = r.take(binaryLength);
+        }
+
+        std::error_code ec;
+        if (!headerOk || !r.ok() || !binary) {
+            AUTOGL_LOG_WARN("ProgramCache", "corrupt cache entry removed: " + file.string());
+            fs::remove(file, ec);
+            return 0;
+        }
+
+        GLuint program = glCreateProgram();
+        if (separable) glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        glProgramBinary(program, format, binary, static_cast<GLsizei>(binaryLength));
+
+        GLint ok = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &ok);
+        if (!ok) {
+            // 드라이버 업데이트 등으로 바이너리가 거부됨 → 재빌드 후 다시 저장됨
+            AUTOGL_LOG_INFO("ProgramCache", "driver rejected cached binary, rebuilding");
+            glDeleteProgram(program);
+            fs::remove(file, ec);
+            return 0;
+        }
+
+        ssboLayout = std::move(layout);
+        AUTOGL_LOG_DEBUG("ProgramCache", "hit " + HashToHex(key));
+        return program;
+    }
+
+    void StoreCachedProgram(std::uint64_t key, GLuint program,
+                            const std::unordered_map<int, SSBOTypeInfo>& ssboLayout) {
+        const std::string dir = detail::cacheDirectory();
+        if (dir.empty() || !program) return;
+
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        if (formats <= 0) {
+            static std::atomic<bool> warned{false};
+            if (!warned.exchange(true)) {
+                AUTOGL_LOG_INFO("ProgramCache", "driver exposes no program binary formats, cache disabled");
+            }
+            return;
+        }
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) return;
+
+        std::vector<char> binary(static_cast<std::size_t>(length));
+        GLenum format = 0;
+        GLsizei written = 0;
+        glGetProgramBinary(program, length, &written, &format, binary.data());
+        if (written <= 0) return;
+
+        detail::ByteWriter w;
+        w.raw(detail::kCacheMagic, sizeof(detail::kCacheMagic));
+        w.u32(detail::kCacheVersion);
+        w.u64(key);
+        w.u32(static_cast<std::uint32_t>(format));
+
+        // SSBO 레이아웃은 소스 파싱 결과라 바이너리만으로는 복원할 수 없음
+        w.u32(static_cast<std::uint32_t>(ssboLayout.size()));
+        for (const auto& [binding, info] : ssboLayout) {
+            w.i32(binding);
+            detail::writeTypeInfo(w, info);
+        }
+
+        w.u32(static_cast<std::uint32_t>(written));
+        w.raw(binary.data(), static_cast<std::size_t>(written));
+
+        std::error_code ec;
+        fs::create_directories(dir, ec);
+
+        // 다른 프로세스/워커가 읽는 도중 잘린 파일을 보지 않도록 임시 파일 후 rename
+        const fs::path file = detail::cacheFilePath(dir, key);
+        fs::path tmp = file;
+        tmp += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+        {
+            std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) {
+                AUTOGL_LOG_WARN("ProgramCache", "cannot write cache entry in " + dir);
+                return;
+            }
+            out.write(w.buf.data(), static_cast<std::streamsize>(w.buf.size()));
+            if (!out) {
+                out.close();
+                fs::remove(tmp, ec);
+                return;
+            }
+        }
+
+        fs::rename(tmp, file, ec);
+        if (ec) fs::remove(tmp, ec);
+    }
+
+} // namespace AutoGL
@@ -0,0 +1,36 @@
+// src/program_binary_cache.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <glad/glad.h>
+
+#include "glsl_types.hpp"
+
+namespace AutoGL {
+
+    // glGetProgramBinary 결과를 디스크에 저장하는 프로그램 캐시.
+    // 키 = 전처리된 소스 + GL_RENDERER + GL_VERSION 해시이므로 드라이버가 바뀌면
+    // 자동으로 미스가 나고, 드라이버가 바이너리를 거부하면 해당 항목을 지우고 재빌드한다.
+    // 워커 컨텍스트에서도 호출되므로 모든 함수는 thread-safe 하다.
+
+    // 기본 위치: $AUTOGL_CACHE_DIR, 없으면 $XDG_CACHE_HOME/autogl (~/.cache/autogl),
+    // Windows는 %LOCALAPPDATA%/AutoGL. 빈 문자열이면 캐시 비활성화
+    void SetProgramCacheDirectory(const std::string& dir);
+    std::string ProgramCacheDirectory();
+    bool ProgramCacheEnabled();
+
+    // 현재 컨텍스트의 드라이버 정보를 포함한 키 (GL 컨텍스트 필요)
+    std::uint64_t MakeProgramCacheKey(const std::string& preprocessedSource);
+
+    // 히트 시 링크된 프로그램과 저장해 둔 SSBO 레이아웃을 돌려줌, 미스면 0
+    // separable stage 프로그램은 separable = true로 불러야 pipeline에 붙일 수 있음
+    GLuint LoadCachedProgram(std::uint64_t key,
+                             std::unordered_map<int, SSBOTypeInfo>& ssboLayout,
+                             bool separable = false);
+
+    // 프로그램은 링크 전에 GL_PROGRAM_BINARY_RETRIEVABLE_HINT가 켜져 있어야 함
+    void StoreCachedProgram(std::uint64_t key, GLuint program,
+                            const std::unordered_map<int, SSBOTypeInfo>& ssboLayout);
+
+} // namespace AutoGL
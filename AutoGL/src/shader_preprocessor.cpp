@@ -0,0 +1,212 @@
+// src/shader_preprocessor.cpp
+#include "shader_preprocessor.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace AutoGL::detail {
+
+    static bool readSourceFile(const std::string& path, std::string& out) {
+        std::ifstream file(path);
+        if (!file.is_open()) return false;
+
+        std::stringstream ss;
+        ss << file.rdbuf();
+        out = ss.str();
+        return true;
+    }
+
+    // "#include "x"", "#include <x>", "@import "x"", "@import x" 에서 경로 추출
+    static bool parseIncludeDirective(const std::string& line, std::string& target) {
+        std::size_t i = line.find_first_not_of(" \t");
+        if (i == std::string::npos) return false;
+
+        if (line[i] == '#') {
+            i = line.find_first_not_of(" \t", i + 1);
+            if (i == std::string::npos || line.compare(i, 7, "include") != 0) return false;
+            i += 7;
+        } else if (line.compare(i, 7, "@import") == 0) {
+            i += 7;
+        } else {
+            return false;
+        }
+
+        i = line.find_first_not_of(" \t", i);
+        if (i == std::string::npos) return false;
+
+        std::size_t end = std::string::npos;
+        if (line[i] == '"') {
+            end = line.find('"', ++i);
+        } else if (line[i] == '<') {
+            end = line.find('>', ++i);
+        } else {
+            end = line.find_first_of(" \t\r\n;", i);
+            if (end == std::string::npos) end = line.size();
+        }
+
+        if (end == std::string::npos || end == i) return false;
+        target = line.substr(i, end - i);
+        return true;
+    }
+
+} // namespace AutoGL::detail
+
+namespace AutoGL {
+
+    std::string ShaderPreprocessor::normalizePath(const std::string& path) {
+        std::error_code ec;
+        fs::path p = fs::absolute(path, ec);
+        if (ec) return path;
+        return p.lexically_normal().string();
+    }
+
+    ShaderPreprocessor::Result ShaderPreprocessor::preprocess(const std::string& path) {
+        const std::string root = normalizePath(path);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        roots_.insert(root);
+
+        Result out;
+        std::vector<std::string> stack;
+        std::unordered_set<std::string> included;
+        out.ok = expandLocked(root, out, stack, included);
+        if (!out.ok) out.source.clear();
+        return out;
+    }
+
+    std::vector<std::string> ShaderPreprocessor::invalidate(const std::string& path) {
+        const std::string file = normalizePath(path);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        parsed_.erase(file);
+
+        // 역방향 그래프를 따라 올라가며 루트 수집
+        std::vector<std::string> roots;
+        std::unordered_set<std::string> visited;
+        std::vector<std::string> work{ file };
+
+        while (!work.empty()) {
+            std::string cur = std::move(work.back());
+            work.pop_back();
+            if (!visited.insert(cur).second) continue;
+
+            if (roots_.count(cur)) roots.push_back(cur);
+
+            auto it = dependents_.find(cur);
+            if (it == dependents_.end()) continue;
+            for (const auto& parent : it->second) {
+                work.push_back(parent);
+            }
+        }
+        return roots;
+    }
+
+    const ShaderPreprocessor::ParsedFile* ShaderPreprocessor::parseLocked(const std::string& file) {
+        auto cached = parsed_.find(file);
+        if (cached != parsed_.end()) return &cached->second;
+
+        std::string text;
+        if (!detail::readSourceFile(file, text)) {
+            AUTOGL_LOG_ERROR("Preprocessor", "failed to open file " + file);
+            return nullptr;
+        }
+
+        ParsedFile pf;
+        const fs::path dir = fs::path(file).parent_path();
+
+        std::string chunk;
+        std::size_t pos = 0;
+        int lineNo = 0;
+
+        while (pos < text.size()) {
+            std::size_t eol = text.find('\n', pos);
+            std::size_t next = (eol == std::string::npos) ? text.size() : eol + 1;
+            ++lineNo;
+
+            std::string target;
+            if (detail::parseIncludeDirective(text.substr(pos, next - pos), target)) {
+                if (!chunk.empty()) {
+                    pf.fragments.push_back(Fragment{ std::move(chunk), {}, 0 });
+                    chunk.clear();
+                }
+
+                std::string resolved = normalizePath((dir / target).string());
+                pf.fragments.push_back(Fragment{ {}, resolved, lineNo });
+                if (std::find(pf.includes.begin(), pf.includes.end(), resolved) == pf.includes.end()) {
+                    pf.includes.push_back(std::move(resolved));
+                }
+            } else {
+                chunk.append(text, pos, next - pos);
+            }
+            pos = next;
+        }
+        if (!chunk.empty()) {
+            pf.fragments.push_back(Fragment{ std::move(chunk), {}, 0 });
+        }
+
+        // 이전 파싱 결과의 간선을 지우고 새 include 목록으로 갱신
+        for (auto& [inc, parents] : dependents_) {
+            parents.erase(file);
+        }
+        for (const auto& inc : pf.includes) {
+            dependents_[inc].insert(file);
+        }
+
+        return &parsed_.emplace(file, std::move(pf)).first->second;
+    }
+
+    bool ShaderPreprocessor::expandLocked(const std::string& file, Result& out,
+                                          std::vector<std::string>& stack,
+                                          std::unordered_set<std::string>& included) {
+        if (std::find(stack.begin(), stack.end(), file) != stack.end()) {
+            AUTOGL_LOG_ERROR("Preprocessor", "circular include: " + file);
+            return false;
+        }
+
+        const ParsedFile* pf = parseLocked(file);
+        if (!pf) return false;
+
+        included.insert(file);
+        // 다른 section에서 다시 포함된 파일은 처음 받은 fileIndex를 그대로 씀
+        auto known = std::find(out.files.begin(), out.files.end(), file);
+        const int fileIndex = static_cast<int>(known - out.files.begin());
+        if (known == out.files.end()) out.files.push_back(file);
+        if (!stack.empty()) out.source += "#line 1 " + std::to_string(fileIndex) + "\n";
+        stack.push_back(file);
+
+        for (const auto& frag : pf->fragments) {
+            if (frag.include.empty()) {
+                out.source += frag.text;
+                // 전개 결과는 @type 기준으로 stage마다 나뉘므로 include-once도 section 단위.
+                // 새 section이 시작되면 앞 section이 포함한 라이브러리를 다시 넣을 수 있게 함
+                if (frag.text.find("@type ") != std::string::npos) {
+                    included.clear();
+                    included.insert(stack.begin(), stack.end());
+                }
+                continue;
+            }
+
+            if (included.count(frag.include) == 0) {
+                if (!expandLocked(frag.include, out, stack, included)) {
+                    AUTOGL_LOG_ERROR("Preprocessor",
+                        "  included from " + file + ":" + std::to_string(frag.line));
+                    return false;
+                }
+                if (!out.source.empty() && out.source.back() != '\n') out.source += '\n';
+            }
+
+            out.source += "#line " + std::to_string(frag.line + 1) + " "
+                        + std::to_string(fileIndex) + "\n";
+        }
+
+        stack.pop_back();
+        return true;
+    }
+
+} // namespace AutoGL
@@ -0,0 +1,60 @@
+// src/shader_preprocessor.hpp
+#pragma once
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace AutoGL {
+
+    // #include "file" / @import "file" 전처리기.
+    // 파일마다 읽어서 include 지시문 기준으로 쪼갠 조각을 캐시하고,
+    // include -> 그 파일을 포함하는 파일의 역방향 그래프를 유지한다.
+    // 라이브러리 파일이 바뀌면 그 파일 캐시만 버리고, 영향받는 루트 셰이더만 다시 빌드.
+    //
+    // - 경로는 포함하는 파일의 디렉토리 기준
+    // - 한 @type section 안에서 같은 파일은 한 번만 포함 (GLSL에는 #pragma once가 없음)
+    // - 포함 경계마다 #line <line> <fileIndex> 를 넣어 컴파일 에러 위치를 추적
+    //
+    // 워커 컨텍스트에서도 호출되므로 내부 mutex로 보호된다.
+    class ShaderPreprocessor {
+    public:
+        struct Result {
+            std::string source;
+            std::vector<std::string> files;  // #line의 fileIndex 순서, [0]이 루트
+            bool ok = false;
+        };
+
+        Result preprocess(const std::string& path);
+
+        // 바뀐 파일의 캐시를 버리고, 다시 빌드해야 하는 루트 셰이더 목록을 반환
+        std::vector<std::string> invalidate(const std::string& path);
+
+        // FileWatcher 이벤트 경로와 비교 가능한 절대 경로
+        static std::string normalizePath(const std::string& path);
+
+    private:
+        struct Fragment {
+            std::string text;       // include가 아니면 원문 조각
+            std::string include;    // 해석된 절대 경로 (비어 있으면 텍스트 조각)
+            int line = 0;           // 지시문이 있던 줄 (1부터)
+        };
+
+        struct ParsedFile {
+            std::vector<Fragment> fragments;
+            std::vector<std::string> includes;
+        };
+
+        std::mutex mutex_;
+        std::unordered_map<std::string, ParsedFile> parsed_;
+        std::unordered_map<std::string, std::unordered_set<std::string>> dependents_;
+        std::unordered_set<std::string> roots_;
+
+        const ParsedFile* parseLocked(const std::string& file);
+        bool expandLocked(const std::string& file, Result& out,
+                          std::vector<std::string>& stack,
+                          std::unordered_set<std::string>& included);
+    };
+
+} // namespace AutoGL
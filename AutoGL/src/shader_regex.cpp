@@ -1,7 +1,9 @@
 // src/shader_regex.cpp
 #include "shader_regex.hpp"
+#include <AutoGL/Log.hpp>
 #include <regex>
 #include <iostream>
+#include <sstream>
 
 namespace AutoGL {
 
@@ -147,4 +149,95 @@ namespace AutoGL {
         return errors;
     }
 
+    int ExtractInstanceCount(std::string& source) {
+        int count = 0;
+
+        std::size_t pos = 0;
+        while (pos < source.size()) {
+            std::size_t eol = source.find('\n', pos);
+            if (eol == std::string::npos) eol = source.size();
+
+            std::size_t i = source.find_first_not_of(" \t", pos);
+            if (i < eol && source.compare(i, 10, "@instances") == 0) {
+                std::istringstream ss(source.substr(i + 10, eol - i - 10));
+
+                long long n = 0;
+                if (!(ss >> n) || n < 1 || n > 0x7fffffff) {
+                    AUTOGL_LOG_WARN("ShaderParse", "@instances needs a positive count, ignored");
+                } else {
+                    count = static_cast<int>(n);
+                }
+
+                source.erase(pos, eol - pos);
+                eol = pos;
+            }
+            pos = eol + 1;
+        }
+        return count;
+    }
+
+    std::string ExtractMeshPath(std::string& source) {
+        std::string path;
+
+        std::size_t pos = 0;
+        while (pos < source.size()) {
+            std::size_t eol = source.find('\n', pos);
+            if (eol == std::string::npos) eol = source.size();
+
+            std::size_t i = source.find_first_not_of(" \t", pos);
+            if (i < eol && source.compare(i, 5, "@mesh") == 0 &&
+                (i + 5 == eol || source[i + 5] == ' ' || source[i + 5] == '\t')) {
+                std::string arg = source.substr(i + 5, eol - i - 5);
+                arg.erase(0, arg.find_first_not_of(" \t"));
+                arg.erase(arg.find_last_not_of(" \t\r") + 1);
+                if (arg.size() >= 2 && arg.front() == '"' && arg.back() == '"') {
+                    arg = arg.substr(1, arg.size() - 2);
+                }
+
+                if (arg.empty()) {
+                    AUTOGL_LOG_WARN("ShaderParse", "@mesh needs a file path, ignored");
+                } else {
+                    if (!path.empty()) {
+                        AUTOGL_LOG_WARN("ShaderParse", "multiple @mesh lines, using the last one");
+                    }
+                    path = arg;
+                }
+
+                source.erase(pos, eol - pos);
+                eol = pos;
+            }
+            pos = eol + 1;
+        }
+        return path;
+    }
+
+    IndirectDrawInfo ExtractIndirectDraw(std::string& source) {
+        IndirectDrawInfo info;
+
+        std::size_t pos = 0;
+        while (pos < source.size()) {
+            std::size_t eol = source.find('\n', pos);
+            if (eol == std::string::npos) eol = source.size();
+
+            std::size_t i = source.find_first_not_of(" \t", pos);
+            if (i < eol && source.compare(i, 9, "@indirect") == 0) {
+                std::istringstream ss(source.substr(i + 9, eol - i - 9));
+
+                long long binding = -1, maxDraws = 0;
+                if (!(ss >> binding >> maxDraws) || binding < 0 || binding > 0xffff ||
+                    maxDraws < 1 || maxDraws > 0x7fffffff) {
+                    AUTOGL_LOG_WARN("ShaderParse", "@indirect needs a binding and a positive max draw count, ignored");
+                } else {
+                    info.binding  = static_cast<int>(binding);
+                    info.maxDraws = static_cast<int>(maxDraws);
+                }
+
+                source.erase(pos, eol - pos);
+                eol = pos;
+            }
+            pos = eol + 1;
+        }
+        return info;
+    }
+
 } // namespace AutoGL
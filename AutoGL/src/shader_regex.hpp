@@ -29,6 +29,19 @@ namespace AutoGL {
         int localSizeZ = 1;
     };
 
+    // @indirect binding maxDraws: binding SSBO 안의 draw 명령으로 multi-draw indirect
+    // (offset 0 = uint 명령 개수, offset 16부터 명령 배열)
+    struct IndirectDrawInfo {
+        int binding  = -1;
+        int maxDraws = 0;
+
+        bool enabled() const noexcept { return binding >= 0 && maxDraws > 0; }
+        bool operator==(const IndirectDrawInfo& o) const noexcept {
+            return binding == o.binding && maxDraws == o.maxDraws;
+        }
+        bool operator!=(const IndirectDrawInfo& o) const noexcept { return !(*this == o); }
+    };
+
     struct ShaderError {
         int line = -1;          // -1이면 정보 없음
         std::string message;
@@ -43,6 +56,18 @@ namespace AutoGL {
     // layout(local_size_x = a, local_size_y = b, local_size_z = c) 파싱
     ComputeLayoutInfo ParseComputeLayout(const std::string& source);
 
+    // "@instances N" 줄을 찾아 N을 돌려주고 소스에서는 빈 줄로 바꿈 (줄 번호 유지)
+    // 없거나 잘못된 값이면 0 (instanced draw 안 함)
+    int ExtractInstanceCount(std::string& source);
+
+    // "@mesh path" 줄을 찾아 path를 돌려주고 소스에서는 빈 줄로 바꿈 (줄 번호 유지)
+    // 공백이 들어간 경로는 따옴표로 감쌈. 없으면 빈 문자열 (fullscreen quad로 그림)
+    std::string ExtractMeshPath(std::string& source);
+
+    // "@indirect binding maxDraws" 줄을 찾아 돌려주고 소스에서는 빈 줄로 바꿈 (줄 번호 유지)
+    // 없거나 잘못된 값이면 enabled() == false
+    IndirectDrawInfo ExtractIndirectDraw(std::string& source);
+
     // GLSL 에러 로그에서 "file:line:" 형태의 라인 정보를 대충 추출
     std::vector<ShaderError> ParseGlslErrorLog(const std::string& log);
 } // namespace AutoGL
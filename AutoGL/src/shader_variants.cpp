@@ -0,0 +1,208 @@
+// src/shader_variants.cpp
+#include "shader_variants.hpp"
+
+#include <AutoGL/Log.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <regex>
+#include <sstream>
+
+namespace AutoGL::detail {
+
+    static bool isNumber(const std::string& s) {
+        if (s.empty()) return false;
+        std::size_t i = (s[0] == '-' || s[0] == '+') ? 1 : 0;
+        if (i == s.size()) return false;
+        bool digit = false;
+        for (; i < s.size(); ++i) {
+            const char c = s[i];
+            if (std::isdigit(static_cast<unsigned char>(c))) digit = true;
+            else if (c != '.' && c != 'u' && c != 'U' && c != 'f' && c != 'e' && c != 'E') return false;
+        }
+        return digit;
+    }
+
+    static bool isOn(const std::string& v) {
+        return v == "on" || v == "1" || v == "true";
+    }
+
+    // 선언된 값 목록에서 선택값을 찾고, 없으면 기본값(첫 번째)
+    static std::size_t resolveValue(const VariantDecl& d, const VariantSelection& sel, bool warn) {
+        auto it = sel.find(d.name);
+        if (it == sel.end()) return 0;
+
+        auto v = std::find(d.values.begin(), d.values.end(), it->second);
+        if (v == d.values.end()) {
+            if (warn) {
+                AUTOGL_LOG_WARN("Variant", "unknown value " + it->second + " for " + d.name
+                    + ", using " + d.values.front());
+            }
+            return 0;
+        }
+        return static_cast<std::size_t>(v - d.values.begin());
+    }
+
+    static const VariantDecl* findDecl(const std::vector<VariantDecl>& decls, const std::string& name) {
+        for (const auto& d : decls) {
+            if (d.name == name) return &d;
+        }
+        return nullptr;
+    }
+
+    static std::string buildDefineBlock(const std::vector<VariantDecl>& decls,
+                                        const VariantSelection& selection) {
+        std::string out;
+
+        for (const auto& d : decls) {
+            if (d.isToggle()) {
+                auto it = selection.find(d.name);
+                if (it != selection.end() && isOn(it->second)) {
+                    out += "#define " + d.name + " 1\n";
+                }
+                continue;
+            }
+
+            const std::size_t idx = resolveValue(d, selection, true);
+            const std::string& value = d.values[idx];
+            if (isNumber(value)) {
+                out += "#define " + d.name + " " + value + "\n";
+            } else {
+                out += "#define " + d.name + " " + std::to_string(idx) + "\n";
+                out += "#define " + d.name + "_" + value + " 1\n";
+            }
+        }
+
+        for (const auto& [name, value] : selection) {
+            if (!findDecl(decls, name)) {
+                out += "#define " + name + " " + value + "\n";
+            }
+        }
+        return out;
+    }
+
+    static void injectAfterVersion(std::string& section, const std::string& block) {
+        if (section.empty() || block.empty()) return;
+
+        std::size_t ver = section.find("#version");
+        if (ver == std::string::npos) {
+            section.insert(0, block);
+            return;
+        }
+
+        std::size_t eol = section.find('\n', ver);
+        if (eol == std::string::npos) {
+            section += '\n';
+            eol = section.size() - 1;
+        }
+
+        // define 줄 수만큼 밀린 줄 번호를 되돌림
+        const int versionLine = 1 + static_cast<int>(std::count(section.begin(), section.begin() + ver, '\n'));
+        section.insert(eol + 1, block + "#line " + std::to_string(versionLine + 1) + "\n");
+    }
+
+} // namespace AutoGL::detail
+
+namespace AutoGL {
+
+    std::vector<VariantDecl> ExtractVariantDecls(std::string& source) {
+        std::vector<VariantDecl> decls;
+
+        std::size_t pos = 0;
+        while (pos < source.size()) {
+            std::size_t eol = source.find('\n', pos);
+            if (eol == std::string::npos) eol = source.size();
+
+            std::size_t i = source.find_first_not_of(" \t", pos);
+            if (i < eol && source.compare(i, 8, "@variant") == 0) {
+                std::istringstream ss(source.substr(i + 8, eol - i - 8));
+
+                VariantDecl d;
+                ss >> d.name;
+                for (std::string v; ss >> v;) d.values.push_back(v);
+
+                if (d.name.empty()) {
+                    AUTOGL_LOG_WARN("Variant", "@variant without a name ignored");
+                } else if (detail::findDecl(decls, d.name)) {
+                    AUTOGL_LOG_WARN("Variant", "duplicate @variant " + d.name + " ignored");
+                } else {
+                    decls.push_back(std::move(d));
+                }
+
+                source.erase(pos, eol - pos);
+                eol = pos;
+            }
+            pos = eol + 1;
+        }
+        return decls;
+    }
+
+    std::string MakeVariantKey(const std::vector<VariantDecl>& decls,
+                               const VariantSelection& selection) {
+        VariantSelection full;
+
+        for (const auto& d : decls) {
+            if (d.isToggle()) {
+                auto it = selection.find(d.name);
+                full[d.name] = (it != selection.end() && detail::isOn(it->second)) ? "on" : "off";
+            } else {
+                full[d.name] = d.values[detail::resolveValue(d, selection, false)];
+            }
+        }
+        for (const auto& [name, value] : selection) {
+            full.emplace(name, value);
+        }
+
+        std::string key;
+        for (const auto& [name, value] : full) {
+            key += name + "=" + value + ";";
+        }
+        return key;
+    }
+
+    void InjectVariantDefines(ShaderSourceSet& sections,
+                              const std::vector<VariantDecl>& decls,
+                              const VariantSelection& selection) {
+        const std::string block = detail::buildDefineBlock(decls, selection);
+        if (block.empty()) return;
+
+        detail::injectAfterVersion(sections.vertex,   block);
+        detail::injectAfterVersion(sections.fragment, block);
+        detail::injectAfterVersion(sections.compute,  block);
+    }
+
+    void SpecializeUniforms(ShaderSourceSet& sections, const VariantSelection& selection) {
+        const std::string prefix = kUniformConstPrefix;
+
+        for (auto it = selection.lower_bound(prefix);
+             it != selection.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+            const std::string name = it->first.substr(prefix.size());
+            if (name.empty()) continue;
+
+            // 이름은 setUniform에서 식별자로 검사된 것만 들어옴
+            const std::regex decl(
+                R"((?:layout\s*\([^)]*\)\s*)?\buniform\s+(?:(?:highp|mediump|lowp)\s+)?)"
+                R"(((?:float|int|uint|bool)|(?:[iu]?vec[234]))\s+)" + name + R"(\s*;)");
+            const std::string replacement = "const $1 " + name + " = $1(" + it->first + ");";
+
+            for (std::string* s : { &sections.vertex, &sections.fragment, &sections.compute }) {
+                if (!s->empty()) *s = std::regex_replace(*s, decl, replacement);
+            }
+        }
+    }
+
+    std::string StripUniformConstants(const std::string& key) {
+        // 키는 "name=value;" 나열이고 특수화 값에는 ';'가 없음
+        const std::string prefix = kUniformConstPrefix;
+        std::string out;
+        std::size_t pos = 0;
+        while (pos < key.size()) {
+            std::size_t end = key.find(';', pos);
+            end = end == std::string::npos ? key.size() : end + 1;
+            if (key.compare(pos, prefix.size(), prefix) != 0) out.append(key, pos, end - pos);
+            pos = end;
+        }
+        return out;
+    }
+
+} // namespace AutoGL
@@ -0,0 +1,53 @@
+// src/shader_variants.hpp
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+
+#include "shader_regex.hpp"
+
+namespace AutoGL {
+
+    // 셰이더 파일 안의 permutation 선언
+    //   @variant QUALITY LOW MED HIGH   → 값 목록, 첫 번째가 기본값
+    //   @variant USE_SHADOWS            → on/off 토글, 기본 off
+    //
+    // 선택된 값은 각 섹션의 #version 바로 뒤에 #define으로 주입된다.
+    //   숫자 값      : #define STEPS 64
+    //   이름 값      : #define QUALITY 2  +  #define QUALITY_HIGH 1  (인덱스는 선언 순서)
+    //   토글 on      : #define USE_SHADOWS 1  (off면 정의하지 않음)
+    //   선언 없는 값 : #define NAME VALUE 그대로
+    struct VariantDecl {
+        std::string name;
+        std::vector<std::string> values;    // 비어 있으면 토글
+
+        bool isToggle() const noexcept { return values.empty(); }
+    };
+
+    // NAME -> VALUE (토글은 "on"/"off")
+    using VariantSelection = std::map<std::string, std::string>;
+
+    // @variant 줄을 찾아 선언으로 모으고 소스에서는 빈 줄로 바꿈 (줄 번호 유지)
+    std::vector<VariantDecl> ExtractVariantDecls(std::string& source);
+
+    // 기본값까지 채운 정규화된 키, 같은 define 집합이면 같은 키
+    std::string MakeVariantKey(const std::vector<VariantDecl>& decls,
+                               const VariantSelection& selection);
+
+    // 각 섹션의 #version 다음 줄에 define 블록 주입
+    void InjectVariantDefines(ShaderSourceSet& sections,
+                              const std::vector<VariantDecl>& decls,
+                              const VariantSelection& selection);
+
+    // uniform 특수화: 선택에 AUTOGL_CONST_NAME = "값[, 값...]" 항목이 있으면 (값은 define으로 주입됨)
+    //   uniform vec3 NAME;  →  const vec3 NAME = vec3(AUTOGL_CONST_NAME);
+    // 으로 바꿔서 컴파일러가 상수로 접고 루프를 펼 수 있게 함 (줄 수 유지).
+    // 지원 타입: float/int/uint/bool 스칼라와 vec/ivec/uvec 2~4, 배열은 바꾸지 않음
+    constexpr const char* kUniformConstPrefix = "AUTOGL_CONST_";
+
+    void SpecializeUniforms(ShaderSourceSet& sections, const VariantSelection& selection);
+
+    // MakeVariantKey 키에서 AUTOGL_CONST_ 항목을 뺀 키 (같은 일반 프로그램의 특수화들이 같은 값)
+    std::string StripUniformConstants(const std::string& key);
+
+} // namespace AutoGL
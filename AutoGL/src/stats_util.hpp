@@ -0,0 +1,142 @@
+// src/stats_util.hpp
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace AutoGL {
+
+    // 프레임/디스패치 시간 샘플 요약
+    struct SampleSummary {
+        std::size_t count = 0;
+        double min    = 0.0;
+        double max    = 0.0;
+        double mean   = 0.0;
+        double median = 0.0;
+        double p95    = 0.0;
+        double stddev = 0.0;
+    };
+
+    // 정렬된 샘플에서 선형 보간 분위수 (q = 0..1)
+    inline double SortedQuantile(const std::vector<double>& sorted, double q) {
+        if (sorted.empty()) return 0.0;
+        const double pos = q * static_cast<double>(sorted.size() - 1);
+        const std::size_t lo = static_cast<std::size_t>(pos);
+        const std::size_t hi = std::min(lo + 1, sorted.size() - 1);
+        return sorted[lo] + (sorted[hi] - sorted[lo]) * (pos - static_cast<double>(lo));
+    }
+
+    inline SampleSummary Summarize(std::vector<double> samples) {
+        SampleSummary s;
+        if (samples.empty()) return s;
+
+        std::sort(samples.begin(), samples.end());
+        s.count  = samples.size();
+        s.min    = samples.front();
+        s.max    = samples.back();
+        s.median = SortedQuantile(samples, 0.5);
+        s.p95    = SortedQuantile(samples, 0.95);
+
+        double sum = 0.0;
+        for (double v : samples) sum += v;
+        s.mean = sum / static_cast<double>(s.count);
+
+        double var = 0.0;
+        for (double v : samples) var += (v - s.mean) * (v - s.mean);
+        s.stddev = s.count > 1 ? std::sqrt(var / static_cast<double>(s.count - 1)) : 0.0;
+        return s;
+    }
+
+    // 두 샘플 집합의 Mann-Whitney U 검정 (동점 보정한 정규 근사, 양측)
+    struct MannWhitneyResult {
+        double u      = 0.0;    // a 쪽 U 통계량
+        double z      = 0.0;
+        double pValue = 1.0;
+    };
+
+    inline MannWhitneyResult MannWhitneyU(const std::vector<double>& a, const std::vector<double>& b) {
+        MannWhitneyResult r;
+        const double n1 = static_cast<double>(a.size());
+        const double n2 = static_cast<double>(b.size());
+        if (a.empty() || b.empty()) return r;
+
+        // (값, a에서 왔는지)를 합쳐 정렬하고 동점은 평균 순위
+        std::vector<std::pair<double, bool>> all;
+        all.reserve(a.size() + b.size());
+        for (double v : a) all.emplace_back(v, true);
+        for (double v : b) all.emplace_back(v, false);
+        std::sort(all.begin(), all.end());
+
+        double rankSumA = 0.0;
+        double tieTerm  = 0.0;     // sum(t^3 - t)
+        for (std::size_t i = 0; i < all.size();) {
+            std::size_t j = i;
+            while (j < all.size() && all[j].first == all[i].first) ++j;
+            const double t = static_cast<double>(j - i);
+            const double rank = (static_cast<double>(i + 1) + static_cast<double>(j)) * 0.5;
+            for (std::size_t k = i; k < j; ++k) {
+                if (all[k].second) rankSumA += rank;
+            }
+            tieTerm += t * t * t - t;
+            i = j;
+        }
+
+        const double n = n1 + n2;
+        r.u = rankSumA - n1 * (n1 + 1.0) * 0.5;
+        const double mean = n1 * n2 * 0.5;
+        const double var  = n1 * n2 / 12.0 * ((n + 1.0) - tieTerm / (n * (n - 1.0)));
+        if (var <= 0.0) return r;
+
+        // 연속성 보정
+        const double diff = r.u - mean;
+        const double corrected = diff > 0.0 ? diff - 0.5 : (diff < 0.0 ? diff + 0.5 : 0.0);
+        r.z      = corrected / std::sqrt(var);
+        r.pValue = std::erfc(std::fabs(r.z) / std::sqrt(2.0));
+        return r;
+    }
+
+    // 추정값과 신뢰구간
+    struct ConfidenceInterval {
+        double estimate = 0.0;
+        double low      = 0.0;
+        double high     = 0.0;
+    };
+
+    // median(a) / median(b)의 percentile bootstrap 신뢰구간.
+    // 같은 입력이면 같은 구간이 나오도록 seed를 고정
+    inline ConfidenceInterval BootstrapMedianRatio(const std::vector<double>& a, const std::vector<double>& b,
+                                                   double confidence = 0.95, int resamples = 2000,
+                                                   std::uint32_t seed = 1) {
+        ConfidenceInterval ci;
+        if (a.empty() || b.empty()) return ci;
+
+        auto median = [](std::vector<double> v) {
+            std::sort(v.begin(), v.end());
+            return SortedQuantile(v, 0.5);
+        };
+        auto ratio = [](double x, double y) { return y > 0.0 ? x / y : 0.0; };
+
+        ci.estimate = ratio(median(a), median(b));
+
+        std::mt19937 rng(seed);
+        std::vector<double> ra(a.size()), rb(b.size()), ratios;
+        ratios.reserve(static_cast<std::size_t>(std::max(resamples, 1)));
+        std::uniform_int_distribution<std::size_t> pickA(0, a.size() - 1), pickB(0, b.size() - 1);
+        for (int i = 0; i < std::max(resamples, 1); ++i) {
+            for (double& v : ra) v = a[pickA(rng)];
+            for (double& v : rb) v = b[pickB(rng)];
+            ratios.push_back(ratio(median(ra), median(rb)));
+        }
+        std::sort(ratios.begin(), ratios.end());
+
+        const double alpha = std::clamp(1.0 - confidence, 0.0, 1.0);
+        ci.low  = SortedQuantile(ratios, alpha * 0.5);
+        ci.high = SortedQuantile(ratios, 1.0 - alpha * 0.5);
+        return ci;
+    }
+
+} // namespace AutoGL
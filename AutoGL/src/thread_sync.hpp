@@ -0,0 +1,93 @@
+// src/thread_sync.hpp
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+namespace AutoGL {
+
+    // 쓰는 스레드가 하나인 seqlock. 쓰기는 절대 막히지 않고, 읽기는 쓰기와 겹치면
+    // 다시 읽는다 (락 없음). 데이터는 word 단위 atomic에 복사해서 data race 없이 읽음.
+    template <typename T>
+    class SeqLock {
+        static_assert(std::is_trivially_copyable<T>::value, "SeqLock<T> requires a trivially copyable T");
+
+    public:
+        SeqLock() { store(T{}); }
+
+        // 쓰는 스레드 하나에서만 호출
+        void store(const T& value) noexcept {
+            std::uint64_t words[kWords] = {};
+            std::memcpy(words, &value, sizeof(T));
+
+            const std::uint32_t s = seq_.load(std::memory_order_relaxed);
+            seq_.store(s + 1, std::memory_order_relaxed);           // 홀수: 쓰는 중
+            std::atomic_thread_fence(std::memory_order_release);
+
+            for (std::size_t i = 0; i < kWords; ++i) {
+                data_[i].store(words[i], std::memory_order_relaxed);
+            }
+            seq_.store(s + 2, std::memory_order_release);
+        }
+
+        // 아무 스레드에서나 호출
+        T load() const noexcept {
+            std::uint64_t words[kWords];
+            for (;;) {
+                const std::uint32_t s1 = seq_.load(std::memory_order_acquire);
+                if (s1 & 1u) continue;
+
+                for (std::size_t i = 0; i < kWords; ++i) {
+                    words[i] = data_[i].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (seq_.load(std::memory_order_relaxed) == s1) break;
+            }
+
+            T out;
+            std::memcpy(&out, words, sizeof(T));
+            return out;
+        }
+
+    private:
+        static constexpr std::size_t kWords = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+        std::atomic<std::uint32_t> seq_{0};
+        std::atomic<std::uint64_t> data_[kWords];
+    };
+
+    // 대기 중인 렌더 스레드를 깨우는 신호. notify가 먼저 와도 다음 wait이 바로 리턴
+    class WakeEvent {
+    public:
+        void notify() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                signaled_ = true;
+            }
+            cv_.notify_one();
+        }
+
+        // timeoutSec < 0 이면 notify가 올 때까지 대기
+        void wait(double timeoutSec) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (timeoutSec < 0.0) {
+                cv_.wait(lock, [this] { return signaled_; });
+            }
+            else {
+                cv_.wait_for(lock, std::chrono::duration<double>(timeoutSec), [this] { return signaled_; });
+            }
+            signaled_ = false;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool signaled_ = false;
+    };
+
+} // namespace AutoGL
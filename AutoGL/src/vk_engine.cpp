@@ -13,13 +13,98 @@ namespace AutoGL {
         // not implemented
     }
 
+    void EngineVKBackend::setDebugMode(GLDebugMode) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setProgramCacheDir(const std::string&) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setShaderVariant(const std::string&, const std::string&) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setOnDemandRendering(bool) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setLateLatchInput(bool) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setOverdrawHeatmap(bool) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setUniform(const std::string&, const std::vector<float>&) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setUniformSpecialization(bool, int) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setShaderProfiling(bool, int) {
+        // not implemented
+    }
+
+    std::vector<ShaderProfileRegion> EngineVKBackend::shaderProfile() const {
+        return {};
+    }
+
+    void EngineVKBackend::setCommandCapture(const std::string&, int) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setInstanceCount(int) {
+        // not implemented
+    }
+
+    void EngineVKBackend::setInstanceData(int, const void*, std::size_t) {
+        // not implemented
+    }
+
+    InputLatencyStats EngineVKBackend::inputLatency() const {
+        return {};
+    }
+
+    PipelineStatistics EngineVKBackend::pipelineStatistics() const {
+        return {};
+    }
+
     void EngineVKBackend::mainLoop(const std::string&) {
         AUTOGL_LOG_ERROR("EngineVK", "Vulkan backend not implemented yet");
     }
 
+    void EngineVKBackend::dashboardLoop(const std::vector<std::string>&) {
+        AUTOGL_LOG_ERROR("EngineVK", "Vulkan backend not implemented yet");
+    }
+
     bool EngineVKBackend::runShaderFile(const std::string&) {
         AUTOGL_LOG_ERROR("EngineVK", "Vulkan backend not implemented yet");
         return false;
     }
 
+    bool EngineVKBackend::renderThumbnailAtlas(const std::vector<std::string>&,
+                                               const ThumbnailAtlasOptions&) {
+        AUTOGL_LOG_ERROR("EngineVK", "Vulkan backend not implemented yet");
+        return false;
+    }
+
+    bool EngineVKBackend::runBatch(const std::vector<std::string>&, const BatchOptions&) {
+        AUTOGL_LOG_ERROR("EngineVK", "Vulkan backend not implemented yet");
+        return false;
+    }
+
+    bool EngineVKBackend::runABTest(const std::string&, const std::string&, const ABTestOptions&) {
+        AUTOGL_LOG_ERROR("EngineVK", "Vulkan backend not implemented yet");
+        return false;
+    }
+
+    bool EngineVKBackend::replayCapture(const std::string&, const ReplayOptions&) {
+        AUTOGL_LOG_ERROR("EngineVK", "Vulkan backend not implemented yet");
+        return false;
+    }
+
 } // namespace AutoGL
@@ -11,9 +11,32 @@ namespace AutoGL {
 
         bool init() override;
         void setWindowSize(int, int) override;
+        void setDebugMode(GLDebugMode) override;
+        void setProgramCacheDir(const std::string&) override;
+        void setShaderVariant(const std::string&, const std::string&) override;
+        void setOnDemandRendering(bool) override;
+        void setLateLatchInput(bool) override;
+        void setOverdrawHeatmap(bool) override;
+        void setUniform(const std::string&, const std::vector<float>&) override;
+        void setUniformSpecialization(bool, int) override;
+        void setShaderProfiling(bool, int) override;
+        std::vector<ShaderProfileRegion> shaderProfile() const override;
+        void setCommandCapture(const std::string&, int) override;
+        void setInstanceCount(int) override;
+        void setInstanceData(int, const void*, std::size_t) override;
+        InputLatencyStats inputLatency() const override;
+        PipelineStatistics pipelineStatistics() const override;
 
         void mainLoop(const std::string& shaderPath) override;
+        void dashboardLoop(const std::vector<std::string>& shaderPaths) override;
         bool runShaderFile(const std::string& path) override;
+        bool renderThumbnailAtlas(const std::vector<std::string>& shaderPaths,
+                                  const ThumbnailAtlasOptions& opts) override;
+        bool runBatch(const std::vector<std::string>& shaderPaths,
+                      const BatchOptions& opts) override;
+        bool runABTest(const std::string& pathA, const std::string& pathB,
+                       const ABTestOptions& opts) override;
+        bool replayCapture(const std::string& path, const ReplayOptions& opts) override;
     };
 
 } // namespace AutoGL
@@ -0,0 +1,205 @@
+// tests/mesh_loader_test.cpp
+// LoadMesh 병렬 파서 검사: 픽스처 파일을 임시 폴더에 만들고 스레드 수를 바꿔 가며 로드
+#include "mesh_loader.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using AutoGL::LoadMesh;
+using AutoGL::MeshData;
+
+namespace {
+
+    int g_failures = 0;
+
+#define CHECK(cond)                                                                 \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++g_failures;                                                           \
+        }                                                                           \
+    } while (0)
+
+    fs::path fixtureDir() {
+        const fs::path dir = fs::temp_directory_path() / "autogl_mesh_loader_test";
+        fs::create_directories(dir);
+        return dir;
+    }
+
+    void writeFile(const fs::path& path, const std::string& bytes) {
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        f.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    // 바이너리 픽스처 작성 (big이면 바이트 순서를 뒤집음)
+    template<class T>
+    void put(std::string& out, T value, bool big = false) {
+        char b[sizeof(T)];
+        std::memcpy(b, &value, sizeof(T));
+        if (big) std::reverse(b, b + sizeof(T));
+        out.append(b, sizeof(T));
+    }
+
+    bool samePosition(const MeshData& m, std::uint32_t index, float x, float y, float z) {
+        if (index >= m.vertices.size()) return false;
+        const float* p = m.vertices[index].position;
+        return p[0] == x && p[1] == y && p[2] == z;
+    }
+
+    // ------------------------------------------------------------------
+    // OBJ: 뒤 청크의 음수 인덱스가 앞 청크의 정점을 가리킴
+    // ------------------------------------------------------------------
+    void testObjNegativeIndicesAcrossChunks() {
+        // 청크는 1 MiB 단위로 나뉘므로 정점 사이에 3 MiB 정도를 채워 면이 마지막 청크에 오게 함
+        constexpr int kFiller = 300000;
+        std::string obj = "v 0 0 0\nv 1 0 0\nv 0 1 0\n";
+        obj.reserve(kFiller * 12 + 128);
+        for (int i = 0; i < kFiller; ++i) obj += "v 9 9 9\n";
+        const int back = kFiller + 3;
+        obj += "f -" + std::to_string(back) + " -" + std::to_string(back - 1) +
+               " -" + std::to_string(back - 2) + "\n";
+        obj += "f 1 3 -1\n";
+
+        const fs::path path = fixtureDir() / "negative.obj";
+        writeFile(path, obj);
+
+        MeshData serial, parallel;
+        CHECK(LoadMesh(path.string(), serial, 1));
+        CHECK(LoadMesh(path.string(), parallel, 4));
+
+        for (const MeshData* m : { &serial, &parallel }) {
+            CHECK(m->indices.size() == 6);
+            if (m->indices.size() != 6) continue;
+            CHECK(samePosition(*m, m->indices[0], 0, 0, 0));
+            CHECK(samePosition(*m, m->indices[1], 1, 0, 0));
+            CHECK(samePosition(*m, m->indices[2], 0, 1, 0));
+            CHECK(samePosition(*m, m->indices[3], 0, 0, 0));
+            CHECK(samePosition(*m, m->indices[4], 0, 1, 0));
+            CHECK(samePosition(*m, m->indices[5], 9, 9, 9));
+        }
+        CHECK(serial.vertices.size() == 4);
+        CHECK(parallel.vertices.size() == serial.vertices.size());
+    }
+
+    // ------------------------------------------------------------------
+    // PLY: 정점 (x, y, z float) + 면 (uchar 개수, int 인덱스)
+    // ------------------------------------------------------------------
+    const float kPlyPositions[5][3] = {
+        { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 }, { 0.5f, 0.5f, 1 },
+    };
+
+    std::string plyFile(const std::vector<std::vector<std::int32_t>>& faces, bool big) {
+        std::string out = std::string("ply\nformat ") + (big ? "binary_big_endian" : "binary_little_endian") +
+                          " 1.0\n"
+                          "element vertex 5\n"
+                          "property float x\nproperty float y\nproperty float z\n"
+                          "element face " + std::to_string(faces.size()) + "\n"
+                          "property list uchar int vertex_indices\n"
+                          "end_header\n";
+        for (const auto& p : kPlyPositions) {
+            for (float v : p) put(out, v, big);
+        }
+        for (const auto& f : faces) {
+            put(out, static_cast<std::uint8_t>(f.size()), big);
+            for (std::int32_t i : f) put(out, i, big);
+        }
+        return out;
+    }
+
+    // 삼각형 고속 경로를 타다가 마지막 사각형에서 순차 파싱으로 돌아감
+    void testPlyMixedPolygons() {
+        std::vector<std::vector<std::int32_t>> faces(7, { 0, 1, 4 });
+        faces.push_back({ 0, 1, 2, 3 });
+        const fs::path path = fixtureDir() / "mixed.ply";
+        writeFile(path, plyFile(faces, false));
+
+        for (unsigned workers : { 1u, 4u }) {
+            MeshData m;
+            CHECK(LoadMesh(path.string(), m, workers));
+            CHECK(m.vertices.size() == 5);
+            const std::vector<std::uint32_t> quad = { 0, 1, 2, 0, 2, 3 };
+            CHECK(m.indices.size() == 7 * 3 + quad.size());
+            if (m.indices.size() != 7 * 3 + quad.size()) continue;
+            for (std::size_t t = 0; t < 7; ++t) {
+                CHECK(m.indices[t * 3] == 0 && m.indices[t * 3 + 1] == 1 && m.indices[t * 3 + 2] == 4);
+            }
+            CHECK(std::equal(quad.begin(), quad.end(), m.indices.end() - static_cast<std::ptrdiff_t>(quad.size())));
+        }
+    }
+
+    void testPlyBigEndian() {
+        const std::vector<std::vector<std::int32_t>> faces = { { 0, 1, 2 }, { 0, 2, 3 }, { 3, 2, 4 } };
+        const fs::path little = fixtureDir() / "little.ply";
+        const fs::path big    = fixtureDir() / "big.ply";
+        writeFile(little, plyFile(faces, false));
+        writeFile(big, plyFile(faces, true));
+
+        MeshData a, b;
+        CHECK(LoadMesh(little.string(), a, 2));
+        CHECK(LoadMesh(big.string(), b, 2));
+        CHECK(b.indices == std::vector<std::uint32_t>({ 0, 1, 2, 0, 2, 3, 3, 2, 4 }));
+        CHECK(a.indices == b.indices);
+        CHECK(b.vertices.size() == 5);
+        for (std::uint32_t i = 0; i < 5 && i < b.vertices.size(); ++i) {
+            CHECK(samePosition(b, i, kPlyPositions[i][0], kPlyPositions[i][1], kPlyPositions[i][2]));
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // STL: 모서리를 공유하는 삼각형 두 개 (-0.0과 0.0도 같은 위치로 합침)
+    // ------------------------------------------------------------------
+    void testStlWeld() {
+        const float tris[2][3][3] = {
+            { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 } },
+            { { -0.0f, 0, 0 }, { 1, 1, 0 }, { 0, 1, -0.0f } },
+        };
+        std::string stl(80, '\0');
+        put(stl, std::uint32_t{2});
+        for (const auto& t : tris) {
+            for (int k = 0; k < 3; ++k) put(stl, 0.0f);     // 면 법선
+            for (const auto& v : t) {
+                for (float c : v) put(stl, c);
+            }
+            put(stl, std::uint16_t{0});
+        }
+        const fs::path path = fixtureDir() / "quad.stl";
+        writeFile(path, stl);
+
+        for (unsigned workers : { 1u, 4u }) {
+            MeshData m;
+            CHECK(LoadMesh(path.string(), m, workers));
+            CHECK(m.vertices.size() == 4);
+            CHECK(m.indices.size() == 6);
+            if (m.indices.size() != 6) continue;
+            CHECK(m.indices[0] == m.indices[3]);    // (0, 0, 0)
+            CHECK(m.indices[2] == m.indices[4]);    // (1, 1, 0)
+            // 파일에 법선이 없으므로 면 법선으로 채움 (+z)
+            for (const auto& v : m.vertices) CHECK(v.normal[2] > 0.99f);
+        }
+    }
+
+} // namespace
+
+int main() {
+    testObjNegativeIndicesAcrossChunks();
+    testPlyMixedPolygons();
+    testPlyBigEndian();
+    testStlWeld();
+
+    std::error_code ec;
+    fs::remove_all(fs::temp_directory_path() / "autogl_mesh_loader_test", ec);
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("mesh_loader_test: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,93 @@
+// tests/shader_preprocessor_test.cpp
+// ShaderPreprocessor include 검사: 여러 @type section에서 같은 라이브러리를 포함
+#include "shader_preprocessor.hpp"
+#include "shader_regex.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+using AutoGL::ShaderPreprocessor;
+
+namespace {
+
+    int g_failures = 0;
+
+#define CHECK(cond)                                                                 \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++g_failures;                                                           \
+        }                                                                           \
+    } while (0)
+
+    fs::path fixtureDir() {
+        const fs::path dir = fs::temp_directory_path() / "autogl_shader_preprocessor_test";
+        fs::create_directories(dir / "lib");
+        return dir;
+    }
+
+    void writeFile(const fs::path& path, const std::string& text) {
+        std::ofstream f(path, std::ios::trunc);
+        f << text;
+    }
+
+    std::size_t countOf(const std::string& text, const std::string& needle) {
+        std::size_t n = 0;
+        for (std::size_t pos = text.find(needle); pos != std::string::npos; pos = text.find(needle, pos + 1)) ++n;
+        return n;
+    }
+
+    // ------------------------------------------------------------------
+    // vertex/fragment가 같은 라이브러리를 포함: 두 section 모두에 한 번씩 전개
+    // ------------------------------------------------------------------
+    void testIncludeInEverySection() {
+        const fs::path dir = fixtureDir();
+        writeFile(dir / "lib" / "common.glsl", "float autogl_common() { return 1.0; }\n");
+        writeFile(dir / "lib" / "noise.glsl",
+                  "#include \"common.glsl\"\n"
+                  "float autogl_noise(vec2 p) { return fract(sin(dot(p, vec2(12.9898, 78.233))) * autogl_common()); }\n");
+        writeFile(dir / "main.glsl",
+                  "@type vertex\n"
+                  "#version 450 core\n"
+                  "#include \"lib/noise.glsl\"\n"
+                  "#include \"lib/noise.glsl\"\n"
+                  "void main() { gl_Position = vec4(autogl_noise(vec2(0.0))); }\n"
+                  "@type fragment\n"
+                  "#version 450 core\n"
+                  "@import \"lib/noise.glsl\"\n"
+                  "out vec4 color;\n"
+                  "void main() { color = vec4(autogl_noise(gl_FragCoord.xy)); }\n");
+
+        ShaderPreprocessor pp;
+        const ShaderPreprocessor::Result r = pp.preprocess((dir / "main.glsl").string());
+        CHECK(r.ok);
+
+        const AutoGL::ShaderSourceSet sections = AutoGL::ExtractShaderSections(r.source);
+        for (const std::string* s : { &sections.vertex, &sections.fragment }) {
+            CHECK(countOf(*s, "float autogl_noise(") == 1);
+            CHECK(countOf(*s, "float autogl_common(") == 1);
+        }
+
+        // 다시 포함해도 파일 목록은 파일마다 하나 (#line fileIndex가 같은 파일을 가리킴)
+        CHECK(r.files.size() == 3);
+        CHECK(countOf(sections.fragment, "#line 1 1\n") == 1);
+    }
+
+} // namespace
+
+int main() {
+    testIncludeInEverySection();
+
+    std::error_code ec;
+    fs::remove_all(fs::temp_directory_path() / "autogl_shader_preprocessor_test", ec);
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("shader_preprocessor_test: all checks passed\n");
+    return 0;
+}